@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/Arena.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::size_t MAX_SAMPLES = 1024;
+constexpr std::size_t MAX_TEXT = 4096;
+} /* anonymous */
+
+// One "frame": a runtime sized batch of samples and a line of text describing them, all thrown away at the end
+
+static void ArenaFrame( benchmark::State& state ) {
+    static EDF::Arena<MAX_SAMPLES * sizeof(std::uint32_t) + MAX_TEXT> arena;
+    const auto count = static_cast<std::size_t>(state.range( 0 ));
+    Bench::XorShift32 random;
+    for( auto _ : state ) {
+        auto scope = arena.scope();
+        EDF::ArenaVector<std::uint32_t> samples( arena, count );
+        EDF::ArenaString text( arena, count * 4 );
+        while( !samples.isFull() ) {
+            samples.pushBack( random.next() & 0xFFF );
+        }
+        for( const auto& sample : samples ) {
+            text.append( sample, 16 ).append( ',' );
+        }
+        benchmark::DoNotOptimize( text.asCString() );
+    }
+    state.counters["footprint"] = static_cast<double>(arena.highWaterMark());
+    Bench::reportPerOp( state, count, sizeof(std::uint32_t) );
+}
+
+static void WorstCaseFrame( benchmark::State& state ) {
+    const auto count = static_cast<std::size_t>(state.range( 0 ));
+    Bench::XorShift32 random;
+    for( auto _ : state ) {
+        EDF::Vector<std::uint32_t, MAX_SAMPLES> samples;
+        EDF::String<MAX_TEXT + 1> text;
+        while( samples.length() != count ) {
+            samples.pushBack( random.next() & 0xFFF );
+        }
+        for( const auto& sample : samples ) {
+            text.append( sample, 16 ).append( ',' );
+        }
+        benchmark::DoNotOptimize( text.asCString() );
+    }
+    state.counters["footprint"] = static_cast<double>(sizeof(EDF::Vector<std::uint32_t, MAX_SAMPLES>) + sizeof(EDF::String<MAX_TEXT + 1>));
+    Bench::reportPerOp( state, count, sizeof(std::uint32_t) );
+}
+
+static void StdHeapFrame( benchmark::State& state ) {
+    const auto count = static_cast<std::size_t>(state.range( 0 ));
+    Bench::XorShift32 random;
+    for( auto _ : state ) {
+        std::vector<std::uint32_t> samples;
+        std::string text;
+        samples.reserve( count );
+        text.reserve( count * 4 );
+        while( samples.size() != count ) {
+            samples.push_back( random.next() & 0xFFF );
+        }
+        for( const auto& sample : samples ) {
+            text.append( EDF::String<32+1>( sample, 16 ).asCString() ).push_back( ',' );
+        }
+        benchmark::DoNotOptimize( text.c_str() );
+    }
+    Bench::reportPerOp( state, count, sizeof(std::uint32_t) );
+}
+
+BENCHMARK( ArenaFrame )->Arg( 16 )->Arg( 256 );
+BENCHMARK( WorstCaseFrame )->Arg( 16 )->Arg( 256 );
+BENCHMARK( StdHeapFrame )->Arg( 16 )->Arg( 256 );
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Bench {
+
+/* 32 byte element, large enough that copies are no longer a single register move */
+struct Payload32 {
+    std::uint32_t key;
+    std::uint32_t data[7];
+
+    constexpr Payload32( std::uint32_t k = 0 ) : key(k), data{} {}
+    constexpr friend bool operator<( const Payload32& lhs, const Payload32& rhs ) { return lhs.key < rhs.key; }
+    constexpr friend bool operator>( const Payload32& lhs, const Payload32& rhs ) { return lhs.key > rhs.key; }
+    constexpr friend bool operator==( const Payload32& lhs, const Payload32& rhs ) { return lhs.key == rhs.key; }
+};
+static_assert( sizeof(Payload32) == 32 );
+
+/* Cheap deterministic pseudo random numbers so the generator doesn't dominate the measurement */
+class XorShift32 {
+private:
+    std::uint32_t state;
+public:
+    constexpr XorShift32( std::uint32_t seed = 0x9E3779B9u ) : state(seed) {}
+    constexpr std::uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+};
+
+/* Report time per operation and bytes of element data read + written per operation */
+inline void reportPerOp( benchmark::State& state, std::size_t opsPerIteration, std::size_t bytesPerOp ) {
+    const auto ops = static_cast<double>(opsPerIteration);
+    state.counters["time/op"] = benchmark::Counter(
+        ops,
+        benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+    );
+    state.SetItemsProcessed( static_cast<std::int64_t>(state.iterations() * opsPerIteration) );
+    state.SetBytesProcessed( static_cast<std::int64_t>(state.iterations() * opsPerIteration * bytesPerOp) );
+}
+
+} /* Bench */
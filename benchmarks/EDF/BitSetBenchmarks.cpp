@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/BitSet.hpp>
+
+#include <bitset>
+
+namespace {
+// About 1 in 8 bits set, like a channel mask or a mostly free slot map
+template<typename Bits, std::size_t N>
+void fill( Bits& bits, std::uint32_t seed ) {
+    Bench::XorShift32 random( seed );
+    for( std::size_t i = 0; i < N; ++i ) {
+        if( (random.next() % 8) == 0 ) {
+            bits.set( i );
+        }
+    }
+}
+} /* anonymous */
+
+template<std::size_t N>
+static void StdBitsetCount( benchmark::State& state ) {
+    std::bitset<N> bits;
+    fill<std::bitset<N>, N>( bits, 1 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( bits );
+        benchmark::DoNotOptimize( bits.count() );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+template<std::size_t N>
+static void BitSetCount( benchmark::State& state ) {
+    EDF::BitSet<N> bits;
+    fill<EDF::BitSet<N>, N>( bits, 1 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( bits );
+        benchmark::DoNotOptimize( bits.count() );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+// Visiting every set bit, the portable way with std::bitset is to test() each one
+template<std::size_t N>
+static void StdBitsetForEachTest( benchmark::State& state ) {
+    std::bitset<N> bits;
+    fill<std::bitset<N>, N>( bits, 2 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( bits );
+        std::size_t sum = 0;
+        for( std::size_t i = 0; i < N; ++i ) {
+            if( bits.test( i ) ) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+// libstdc++ extension, the closest std::bitset gets to findFirstSet()/findNextSet()
+template<std::size_t N>
+static void StdBitsetForEachFindNext( benchmark::State& state ) {
+    std::bitset<N> bits;
+    fill<std::bitset<N>, N>( bits, 2 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( bits );
+        std::size_t sum = 0;
+        for( std::size_t i = bits._Find_first(); i < N; i = bits._Find_next( i ) ) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+template<std::size_t N>
+static void BitSetForEachFindNext( benchmark::State& state ) {
+    EDF::BitSet<N> bits;
+    fill<EDF::BitSet<N>, N>( bits, 2 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( bits );
+        std::size_t sum = 0;
+        for( std::size_t i = bits.findFirstSet(); i < N; i = bits.findNextSet( i ) ) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+// Masking a snapshot against an enable mask and looking for changes
+template<std::size_t N>
+static void StdBitsetAndXor( benchmark::State& state ) {
+    std::bitset<N> snapshot;
+    std::bitset<N> enabled;
+    std::bitset<N> previous;
+    fill<std::bitset<N>, N>( snapshot, 3 );
+    fill<std::bitset<N>, N>( enabled, 4 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( snapshot );
+        auto changed = (snapshot & enabled) ^ previous;
+        benchmark::DoNotOptimize( changed );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+template<std::size_t N>
+static void BitSetAndXor( benchmark::State& state ) {
+    EDF::BitSet<N> snapshot;
+    EDF::BitSet<N> enabled;
+    EDF::BitSet<N> previous;
+    fill<EDF::BitSet<N>, N>( snapshot, 3 );
+    fill<EDF::BitSet<N>, N>( enabled, 4 );
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( snapshot );
+        auto changed = (snapshot & enabled) ^ previous;
+        benchmark::DoNotOptimize( changed );
+    }
+    Bench::reportPerOp( state, 1, N / 8 );
+}
+
+BENCHMARK_TEMPLATE( StdBitsetCount, 256 );
+BENCHMARK_TEMPLATE( StdBitsetCount, 4096 );
+BENCHMARK_TEMPLATE( BitSetCount, 256 );
+BENCHMARK_TEMPLATE( BitSetCount, 4096 );
+
+BENCHMARK_TEMPLATE( StdBitsetForEachTest, 256 );
+BENCHMARK_TEMPLATE( StdBitsetForEachTest, 4096 );
+BENCHMARK_TEMPLATE( StdBitsetForEachFindNext, 256 );
+BENCHMARK_TEMPLATE( StdBitsetForEachFindNext, 4096 );
+BENCHMARK_TEMPLATE( BitSetForEachFindNext, 256 );
+BENCHMARK_TEMPLATE( BitSetForEachFindNext, 4096 );
+
+BENCHMARK_TEMPLATE( StdBitsetAndXor, 256 );
+BENCHMARK_TEMPLATE( StdBitsetAndXor, 4096 );
+BENCHMARK_TEMPLATE( BitSetAndXor, 256 );
+BENCHMARK_TEMPLATE( BitSetAndXor, 4096 );
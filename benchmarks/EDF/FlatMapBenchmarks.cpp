@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/FlatMap.hpp>
+#include <EDF/Vector.hpp>
+
+#include <algorithm>
+
+namespace {
+constexpr std::size_t LOOKUPS = 256;
+
+// Keys spread out like register addresses or channel ids, not 0..N-1
+constexpr std::uint32_t keyFor( std::size_t k ) { return static_cast<std::uint32_t>(k) * 2654435761u; }
+
+template<std::size_t N>
+void fillKeys( std::uint32_t (&keys)[LOOKUPS] ) {
+    Bench::XorShift32 random;
+    for( auto& key : keys ) {
+        key = keyFor( random.next() % N );
+    }
+}
+
+template<std::size_t N>
+void fillSorted( EDF::Vector<EDF::KeyValue<std::uint32_t, std::uint32_t>, N>& table ) {
+    table.clear();
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.pushBack( { keyFor( k ), static_cast<std::uint32_t>(k) } );
+    }
+    std::sort( table.begin(), table.end(), []( const auto& lhs, const auto& rhs ){ return lhs.key < rhs.key; } );
+}
+} /* anonymous */
+
+// The same table searched with a linear scan, see VectorLinearFind in MapBenchmarks.cpp
+template<std::size_t N>
+static void LinearFind( benchmark::State& state ) {
+    static EDF::Vector<EDF::KeyValue<std::uint32_t, std::uint32_t>, N> table;
+    fillSorted( table );
+    std::uint32_t keys[LOOKUPS];
+    fillKeys<N>( keys );
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto key : keys ) {
+            sum += std::find_if( table.begin(), table.end(), [key]( const auto& entry ){ return entry.key == key; } )->value;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(EDF::KeyValue<std::uint32_t, std::uint32_t>) );
+}
+
+// Same sorted table, searched with the standard library's branchy binary search
+template<std::size_t N>
+static void StdLowerBoundFind( benchmark::State& state ) {
+    static EDF::Vector<EDF::KeyValue<std::uint32_t, std::uint32_t>, N> table;
+    fillSorted( table );
+    std::uint32_t keys[LOOKUPS];
+    fillKeys<N>( keys );
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto key : keys ) {
+            sum += std::lower_bound( table.begin(), table.end(), key, []( const auto& entry, std::uint32_t k ){ return entry.key < k; } )->value;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(EDF::KeyValue<std::uint32_t, std::uint32_t>) );
+}
+
+template<std::size_t N>
+static void FlatMapFind( benchmark::State& state ) {
+    static EDF::FlatMap<std::uint32_t, std::uint32_t, N> table;
+    table.clear();
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.insert( keyFor( k ), static_cast<std::uint32_t>(k) );
+    }
+    std::uint32_t keys[LOOKUPS];
+    fillKeys<N>( keys );
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto key : keys ) {
+            sum += *table.find( key );
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(EDF::KeyValue<std::uint32_t, std::uint32_t>) );
+}
+
+// Adding N/2 sorted keys to a map already holding N/2, one insert at a time
+template<std::size_t N>
+static void FlatMapInsertEach( benchmark::State& state ) {
+    static EDF::FlatMap<std::uint32_t, std::uint32_t, N> table;
+    static EDF::KeyValue<std::uint32_t, std::uint32_t> more[N / 2];
+    for( std::size_t k = 0; k < N / 2; ++k ) {
+        more[k] = { static_cast<std::uint32_t>(2 * k + 1), 0 };
+    }
+    for( auto _ : state ) {
+        state.PauseTiming();
+        table.clear();
+        for( std::size_t k = 0; k < N / 2; ++k ) {
+            table.insert( static_cast<std::uint32_t>(2 * k), 0 );
+        }
+        state.ResumeTiming();
+        for( const auto& entry : more ) {
+            table.insert( entry.key, entry.value );
+        }
+        benchmark::DoNotOptimize( table.cbegin() );
+    }
+    Bench::reportPerOp( state, N / 2, sizeof(EDF::KeyValue<std::uint32_t, std::uint32_t>) );
+}
+
+template<std::size_t N>
+static void FlatMapInsertSorted( benchmark::State& state ) {
+    static EDF::FlatMap<std::uint32_t, std::uint32_t, N> table;
+    static EDF::KeyValue<std::uint32_t, std::uint32_t> more[N / 2];
+    for( std::size_t k = 0; k < N / 2; ++k ) {
+        more[k] = { static_cast<std::uint32_t>(2 * k + 1), 0 };
+    }
+    for( auto _ : state ) {
+        state.PauseTiming();
+        table.clear();
+        for( std::size_t k = 0; k < N / 2; ++k ) {
+            table.insert( static_cast<std::uint32_t>(2 * k), 0 );
+        }
+        state.ResumeTiming();
+        table.insertSorted( std::begin( more ), std::end( more ) );
+        benchmark::DoNotOptimize( table.cbegin() );
+    }
+    Bench::reportPerOp( state, N / 2, sizeof(EDF::KeyValue<std::uint32_t, std::uint32_t>) );
+}
+
+BENCHMARK_TEMPLATE( LinearFind, 8 );
+BENCHMARK_TEMPLATE( LinearFind, 64 );
+BENCHMARK_TEMPLATE( LinearFind, 512 );
+BENCHMARK_TEMPLATE( StdLowerBoundFind, 8 );
+BENCHMARK_TEMPLATE( StdLowerBoundFind, 64 );
+BENCHMARK_TEMPLATE( StdLowerBoundFind, 512 );
+BENCHMARK_TEMPLATE( FlatMapFind, 8 );
+BENCHMARK_TEMPLATE( FlatMapFind, 64 );
+BENCHMARK_TEMPLATE( FlatMapFind, 512 );
+
+BENCHMARK_TEMPLATE( FlatMapInsertEach, 64 );
+BENCHMARK_TEMPLATE( FlatMapInsertEach, 512 );
+BENCHMARK_TEMPLATE( FlatMapInsertSorted, 64 );
+BENCHMARK_TEMPLATE( FlatMapInsertSorted, 512 );
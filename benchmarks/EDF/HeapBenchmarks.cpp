@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/Heap.hpp>
+#include <EDF/IndexedHeap.hpp>
+#include <EDF/RadixHeap.hpp>
+#include <EDF/Vector.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace {
+// Reference: the previous Heap, which constructed Compare() per comparison and std::swap()ed at every level
+template<typename T, std::size_t N, typename Compare>
+class SwapHeap {
+private:
+    EDF::Vector<T, N> heap;
+public:
+    bool isEmpty()                      const { return heap.isEmpty(); }
+    bool isFull()                       const { return heap.isFull(); }
+    std::size_t length()                const { return heap.length(); }
+    std::size_t maxLength()             const { return heap.maxLength(); }
+
+    void push( const T& value ) {
+        heap.pushBack( value );
+        std::size_t index = heap.length() - 1;
+        while( index != 0 ) {
+            std::size_t parentIndex = (index - 1) / 2;
+            if( Compare()( heap[parentIndex], heap[index] ) ) {
+                break;
+            }
+            std::swap( heap[parentIndex], heap[index] );
+            index = parentIndex;
+        }
+    }
+
+    T pop() {
+        T topValue = std::move(heap.front());
+        heap.front() = std::move(heap.back());
+        heap.popBack();
+        std::size_t index = 0;
+        while( true ) {
+            std::size_t leftChild = 2 * index + 1;
+            std::size_t rightChild = leftChild + 1;
+            std::size_t topIndex = index;
+            if( (leftChild < heap.length()) && Compare()(heap[leftChild], heap[topIndex]) ) {
+                topIndex = leftChild;
+            }
+            if( (rightChild < heap.length()) && Compare()(heap[rightChild], heap[topIndex]) ) {
+                topIndex = rightChild;
+            }
+            if( topIndex == index ) {
+                break;
+            }
+            std::swap( heap[index], heap[topIndex] );
+            index = topIndex;
+        }
+        return topValue;
+    }
+};
+} /* anonymous */
+
+template<typename T, std::size_t N, typename H = EDF::HeapMin<T, N>>
+static void HeapPushPop( benchmark::State& state ) {
+    H heap;
+    Bench::XorShift32 rng;
+    // Half full heap so both bubbleUp and bubbleDown have a realistic depth to walk
+    while( heap.length() < heap.maxLength() / 2 ) {
+        heap.push( T(rng.next()) );
+    }
+    for( auto _ : state ) {
+        heap.push( T(rng.next()) );
+        auto value = heap.pop();
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+template<typename T, std::size_t N, typename H = EDF::HeapMin<T, N>>
+static void HeapFillDrain( benchmark::State& state ) {
+    H heap;
+    Bench::XorShift32 rng;
+    for( auto _ : state ) {
+        while( !heap.isFull() ) {
+            heap.push( T(rng.next()) );
+        }
+        while( !heap.isEmpty() ) {
+            auto value = heap.pop();
+            benchmark::DoNotOptimize( value );
+        }
+    }
+    Bench::reportPerOp( state, 2 * heap.maxLength(), sizeof(T) );
+}
+
+// Restore a whole heap from a buffer, EX: a persisted schedule at boot
+template<typename T, std::size_t N>
+static void HeapAssign( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    static T values[N];
+    Bench::XorShift32 rng;
+    for( auto& value : values ) {
+        value = T(rng.next());
+    }
+    for( auto _ : state ) {
+        heap.assign( values, values + N );
+        benchmark::DoNotOptimize( heap.peek() );
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// Baseline: one push() per element
+template<typename T, std::size_t N>
+static void HeapAssignPush( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    static T values[N];
+    Bench::XorShift32 rng;
+    for( auto& value : values ) {
+        value = T(rng.next());
+    }
+    for( auto _ : state ) {
+        heap.clear();
+        for( const auto& value : values ) {
+            heap.push( value );
+        }
+        benchmark::DoNotOptimize( heap.peek() );
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// Add state.range(0) elements to a half full heap with pushBatch()
+template<typename T, std::size_t N>
+static void HeapPushBatch( benchmark::State& state ) {
+    const auto count = static_cast<std::size_t>(state.range( 0 ));
+    EDF::HeapMin<T, N> heap;
+    static T values[N];
+    Bench::XorShift32 rng;
+    for( auto& value : values ) {
+        value = T(rng.next());
+    }
+    for( auto _ : state ) {
+        state.PauseTiming();
+        heap.assign( values, values + N / 2 );
+        state.ResumeTiming();
+        heap.pushBatch( values + N / 2, values + N / 2 + count );
+        benchmark::DoNotOptimize( heap.peek() );
+    }
+    Bench::reportPerOp( state, count, sizeof(T) );
+}
+
+// The next 10 elements, EX: the next 10 deadlines
+template<typename T, std::size_t N>
+static void HeapTopK( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    Bench::XorShift32 rng;
+    while( !heap.isFull() ) {
+        heap.push( T(rng.next()) );
+    }
+    T top[10];
+    for( auto _ : state ) {
+        heap.topK( 10, top );
+        benchmark::DoNotOptimize( top );
+    }
+    Bench::reportPerOp( state, 10, sizeof(T) );
+}
+
+// Baseline: copy the whole heap and pop 10 times
+template<typename T, std::size_t N>
+static void HeapTopKCopyPop( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    Bench::XorShift32 rng;
+    while( !heap.isFull() ) {
+        heap.push( T(rng.next()) );
+    }
+    T top[10];
+    for( auto _ : state ) {
+        auto copy = heap;
+        for( auto& value : top ) {
+            value = copy.pop();
+        }
+        benchmark::DoNotOptimize( top );
+    }
+    Bench::reportPerOp( state, 10, sizeof(T) );
+}
+
+template<typename T, std::size_t N>
+static void HeapSortInto( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    Bench::XorShift32 rng;
+    for( auto _ : state ) {
+        state.PauseTiming();
+        heap.clear();
+        while( !heap.isFull() ) {
+            heap.push( T(rng.next()) );
+        }
+        state.ResumeTiming();
+        auto sorted = heap.sortInto();
+        benchmark::DoNotOptimize( sorted.data() );
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// Timer list: keep the heap half full, pop the next deadline, schedule a new one a random delay after it
+template<typename H, std::size_t N>
+static void MonotonePushPop( benchmark::State& state ) {
+    H heap;
+    Bench::XorShift32 rng;
+    auto refill = [&](){
+        heap.clear();
+        while( heap.length() < N / 2 ) {
+            heap.push( rng.next() % 1000 );
+        }
+    };
+    refill();
+    for( auto _ : state ) {
+        const std::uint32_t now = heap.pop();
+        heap.push( now + (rng.next() % 1000) );
+        benchmark::DoNotOptimize( now );
+        // Start over long before the ticks wrap
+        if( now > (UINT32_MAX / 2) ) {
+            state.PauseTiming();
+            refill();
+            state.ResumeTiming();
+        }
+    }
+    Bench::reportPerOp( state, 2, sizeof(std::uint32_t) );
+}
+
+// Change one pending element's value in place
+template<typename T, std::size_t N>
+static void IndexedHeapUpdate( benchmark::State& state ) {
+    EDF::IndexedHeapMin<T, N> heap;
+    Bench::XorShift32 rng;
+    while( !heap.isFull() ) {
+        heap.push( T(rng.next()) );
+    }
+    for( auto _ : state ) {
+        heap.update( rng.next() % N, T(rng.next()) );
+        benchmark::DoNotOptimize( heap.peek() );
+    }
+    Bench::reportPerOp( state, 1, sizeof(T) );
+}
+
+// Baseline: without handles, changing one element means popping everything and pushing it back
+template<typename T, std::size_t N>
+static void HeapRebuildUpdate( benchmark::State& state ) {
+    EDF::HeapMin<T, N> heap;
+    EDF::Vector<T, N> scratch;
+    Bench::XorShift32 rng;
+    while( !heap.isFull() ) {
+        heap.push( T(rng.next()) );
+    }
+    for( auto _ : state ) {
+        const std::size_t target = rng.next() % N;
+        while( !heap.isEmpty() ) {
+            scratch.pushBack( heap.pop() );
+        }
+        scratch[target] = T(rng.next());
+        for( const auto& value : scratch ) {
+            heap.push( value );
+        }
+        scratch.clear();
+        benchmark::DoNotOptimize( heap.peek() );
+    }
+    Bench::reportPerOp( state, 1, sizeof(T) );
+}
+
+BENCHMARK_TEMPLATE( HeapPushPop, std::uint32_t, 16 );
+BENCHMARK_TEMPLATE( HeapPushPop, std::uint32_t, 100 );
+BENCHMARK_TEMPLATE( HeapPushPop, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( HeapPushPop, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( HeapPushPop, Bench::Payload32, 16 );
+BENCHMARK_TEMPLATE( HeapPushPop, Bench::Payload32, 100 );
+BENCHMARK_TEMPLATE( HeapPushPop, Bench::Payload32, 256 );
+
+BENCHMARK_TEMPLATE( HeapFillDrain, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( HeapFillDrain, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( HeapFillDrain, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( HeapFillDrain, Bench::Payload32, 60 );
+
+// Arity crossover: binary vs 4-ary vs 8-ary, from one cache line worth of elements up to 64K
+#define EDF_HEAP_ARITY_BENCHMARKS( T, N ) \
+    BENCHMARK_TEMPLATE( HeapPushPop, T, N, EDF::HeapMin<T, N, 2> ); \
+    BENCHMARK_TEMPLATE( HeapPushPop, T, N, EDF::HeapMin<T, N, 4> ); \
+    BENCHMARK_TEMPLATE( HeapPushPop, T, N, EDF::HeapMin<T, N, 8> ); \
+    BENCHMARK_TEMPLATE( HeapFillDrain, T, N, EDF::HeapMin<T, N, 2> ); \
+    BENCHMARK_TEMPLATE( HeapFillDrain, T, N, EDF::HeapMin<T, N, 4> ); \
+    BENCHMARK_TEMPLATE( HeapFillDrain, T, N, EDF::HeapMin<T, N, 8> )
+
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 16 );
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 256 );
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 1024 );
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 4096 );
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 16384 );
+EDF_HEAP_ARITY_BENCHMARKS( std::uint32_t, 65536 );
+EDF_HEAP_ARITY_BENCHMARKS( Bench::Payload32, 64 );
+EDF_HEAP_ARITY_BENCHMARKS( Bench::Payload32, 1024 );
+EDF_HEAP_ARITY_BENCHMARKS( Bench::Payload32, 16384 );
+
+BENCHMARK_TEMPLATE( HeapAssign, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( HeapAssign, std::uint32_t, 16384 );
+BENCHMARK_TEMPLATE( HeapAssign, Bench::Payload32, 1024 );
+BENCHMARK_TEMPLATE( HeapAssignPush, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( HeapAssignPush, std::uint32_t, 16384 );
+BENCHMARK_TEMPLATE( HeapAssignPush, Bench::Payload32, 1024 );
+BENCHMARK_TEMPLATE( HeapPushBatch, std::uint32_t, 16384 )->RangeMultiplier( 4 )->Range( 4, 8192 );
+
+BENCHMARK_TEMPLATE( HeapTopK, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( HeapTopK, std::uint32_t, 4096 );
+BENCHMARK_TEMPLATE( HeapTopK, Bench::Payload32, 1024 );
+BENCHMARK_TEMPLATE( HeapTopKCopyPop, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( HeapTopKCopyPop, std::uint32_t, 4096 );
+BENCHMARK_TEMPLATE( HeapTopKCopyPop, Bench::Payload32, 1024 );
+BENCHMARK_TEMPLATE( HeapSortInto, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( HeapSortInto, Bench::Payload32, 1024 );
+
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::HeapMin<std::uint32_t, 64>, 64 );
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::HeapMin<std::uint32_t, 1024>, 1024 );
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::HeapMin<std::uint32_t, 16384>, 16384 );
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::RadixHeap<std::uint32_t, 64>, 64 );
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::RadixHeap<std::uint32_t, 1024>, 1024 );
+BENCHMARK_TEMPLATE( MonotonePushPop, EDF::RadixHeap<std::uint32_t, 16384>, 16384 );
+
+BENCHMARK_TEMPLATE( IndexedHeapUpdate, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( IndexedHeapUpdate, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( IndexedHeapUpdate, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( HeapRebuildUpdate, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( HeapRebuildUpdate, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( HeapRebuildUpdate, Bench::Payload32, 64 );
+
+BENCHMARK_TEMPLATE( HeapPushPop, std::uint32_t, 256, SwapHeap<std::uint32_t, 256, std::less<std::uint32_t>> );
+BENCHMARK_TEMPLATE( HeapPushPop, Bench::Payload32, 256, SwapHeap<Bench::Payload32, 256, std::less<Bench::Payload32>> );
+BENCHMARK_TEMPLATE( HeapFillDrain, std::uint32_t, 1000, SwapHeap<std::uint32_t, 1000, std::less<std::uint32_t>> );
+BENCHMARK_TEMPLATE( HeapFillDrain, Bench::Payload32, 64, SwapHeap<Bench::Payload32, 64, std::less<Bench::Payload32>> );
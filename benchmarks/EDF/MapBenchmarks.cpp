@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/Map.hpp>
+#include <EDF/Vector.hpp>
+
+#include <algorithm>
+
+namespace {
+constexpr std::size_t LOOKUPS = 256;
+
+template<typename K>
+struct Pair {
+    K key;
+    std::uint32_t value;
+};
+
+// Keys spread out like register addresses or channel ids, not 0..N-1
+constexpr std::uint32_t keyFor( std::size_t k ) { return static_cast<std::uint32_t>(k) * 2654435761u; }
+
+EDF::String<16> nameFor( std::size_t k ) {
+    return EDF::String<16>( "command_" ).append( static_cast<std::uint32_t>(k) );
+}
+} /* anonymous */
+
+// The usual lookup table today, a linear scan over an EDF::Vector
+template<std::size_t N>
+static void VectorLinearFind( benchmark::State& state ) {
+    EDF::Vector<Pair<std::uint32_t>, N> table;
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.pushBack( { keyFor( k ), static_cast<std::uint32_t>(k) } );
+    }
+    Bench::XorShift32 random;
+    std::uint32_t keys[LOOKUPS];
+    for( auto& key : keys ) {
+        key = keyFor( random.next() % N );
+    }
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto key : keys ) {
+            sum += std::find_if( table.begin(), table.end(), [key]( const auto& pair ){ return pair.key == key; } )->value;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(Pair<std::uint32_t>) );
+}
+
+template<std::size_t N>
+static void MapFind( benchmark::State& state ) {
+    static EDF::Map<std::uint32_t, std::uint32_t, N> table;
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.insert( keyFor( k ), static_cast<std::uint32_t>(k) );
+    }
+    Bench::XorShift32 random;
+    std::uint32_t keys[LOOKUPS];
+    for( auto& key : keys ) {
+        key = keyFor( random.next() % N );
+    }
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto key : keys ) {
+            sum += *table.find( key );
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(Pair<std::uint32_t>) );
+}
+
+// Command dispatch by name
+template<std::size_t N>
+static void VectorLinearFindString( benchmark::State& state ) {
+    static EDF::Vector<Pair<EDF::String<16>>, N> table;
+    table.clear();
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.pushBack( { nameFor( k ), static_cast<std::uint32_t>(k) } );
+    }
+    Bench::XorShift32 random;
+    static EDF::String<16> keys[LOOKUPS];
+    for( auto& key : keys ) {
+        key = nameFor( random.next() % N );
+    }
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto& key : keys ) {
+            sum += std::find_if( table.begin(), table.end(), [&key]( const auto& pair ){ return pair.key == key; } )->value;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(EDF::String<16>) );
+}
+
+template<std::size_t N>
+static void MapFindString( benchmark::State& state ) {
+    static EDF::Map<EDF::String<16>, std::uint32_t, N> table;
+    for( std::size_t k = 0; k < N; ++k ) {
+        table.insert( nameFor( k ), static_cast<std::uint32_t>(k) );
+    }
+    Bench::XorShift32 random;
+    static EDF::String<16> keys[LOOKUPS];
+    for( auto& key : keys ) {
+        key = nameFor( random.next() % N );
+    }
+    for( auto _ : state ) {
+        std::uint32_t sum = 0;
+        for( const auto& key : keys ) {
+            sum += *table.find( key );
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    Bench::reportPerOp( state, LOOKUPS, sizeof(EDF::String<16>) );
+}
+
+BENCHMARK_TEMPLATE( VectorLinearFind, 8 );
+BENCHMARK_TEMPLATE( VectorLinearFind, 64 );
+BENCHMARK_TEMPLATE( VectorLinearFind, 512 );
+BENCHMARK_TEMPLATE( MapFind, 8 );
+BENCHMARK_TEMPLATE( MapFind, 64 );
+BENCHMARK_TEMPLATE( MapFind, 512 );
+
+BENCHMARK_TEMPLATE( VectorLinearFindString, 8 );
+BENCHMARK_TEMPLATE( VectorLinearFindString, 64 );
+BENCHMARK_TEMPLATE( VectorLinearFindString, 512 );
+BENCHMARK_TEMPLATE( MapFindString, 8 );
+BENCHMARK_TEMPLATE( MapFindString, 64 );
+BENCHMARK_TEMPLATE( MapFindString, 512 );
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/Pool.hpp>
+
+#include <cstdlib>
+
+namespace {
+// Hands out and takes back blocks through the same interface as Pool, backed by glibc malloc
+template<typename T, std::size_t N>
+struct MallocPool {
+    T* allocate()                   { return static_cast<T*>(std::malloc( sizeof(T) )); }
+    void deallocate( T* pointer )   { std::free( pointer ); }
+};
+} /* anonymous */
+
+// Allocate one block and free it straight away, the common case for a message or timer object
+template<typename P, typename T>
+static void PoolAllocateFree( benchmark::State& state ) {
+    static P pool;
+    for( auto _ : state ) {
+        T* pointer = pool.allocate();
+        benchmark::DoNotOptimize( pointer );
+        pool.deallocate( pointer );
+    }
+    Bench::reportPerOp( state, 1, sizeof(T) );
+}
+
+// Allocate Count blocks, then free them in a scrambled order so the free list doesn't stay sequential
+template<typename P, typename T, std::size_t Count>
+static void PoolAllocateFreeScrambled( benchmark::State& state ) {
+    static P pool;
+    T* pointers[Count] = {};
+    for( auto _ : state ) {
+        for( auto& pointer : pointers ) {
+            pointer = pool.allocate();
+        }
+        benchmark::DoNotOptimize( pointers );
+        // 7 is coprime with a power of 2 Count, so every block is freed exactly once
+        for( std::size_t k = 0; k < Count; ++k ) {
+            pool.deallocate( pointers[(k * 7) % Count] );
+        }
+    }
+    Bench::reportPerOp( state, 2 * Count, sizeof(T) );
+}
+
+BENCHMARK_TEMPLATE( PoolAllocateFree, EDF::Pool<Bench::Payload32, 64>, Bench::Payload32 );
+BENCHMARK_TEMPLATE( PoolAllocateFree, EDF::AtomicPool<Bench::Payload32, 64>, Bench::Payload32 );
+BENCHMARK_TEMPLATE( PoolAllocateFree, MallocPool<Bench::Payload32, 64>, Bench::Payload32 );
+
+BENCHMARK_TEMPLATE( PoolAllocateFreeScrambled, EDF::Pool<Bench::Payload32, 256>, Bench::Payload32, 256 );
+BENCHMARK_TEMPLATE( PoolAllocateFreeScrambled, EDF::AtomicPool<Bench::Payload32, 256>, Bench::Payload32, 256 );
+BENCHMARK_TEMPLATE( PoolAllocateFreeScrambled, MallocPool<Bench::Payload32, 256>, Bench::Payload32, 256 );
+BENCHMARK_TEMPLATE( PoolAllocateFreeScrambled, EDF::Pool<std::uint32_t, 256>, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( PoolAllocateFreeScrambled, MallocPool<std::uint32_t, 256>, std::uint32_t, 256 );
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/MPMCQueue.hpp>
+#include <EDF/OverwriteQueue.hpp>
+#include <EDF/Queue.hpp>
+#include <EDF/QueueReader.hpp>
+#include <EDF/QueueWriter.hpp>
+#include <EDF/SPSCQueue.hpp>
+
+#include <cstring>
+#include <mutex>
+
+template<typename T, std::size_t N, EDF::QueueMode M = EDF::QueueMode::wrapped>
+static void QueuePushPop( benchmark::State& state ) {
+    EDF::Queue<T, N, M> queue;
+    // Keep the queue half full so head and tail walk across the whole buffer and wrap
+    while( queue.length() < queue.maxLength() / 2 ) {
+        queue.push( T() );
+    }
+    T value{};
+    for( auto _ : state ) {
+        queue.push( value );
+        value = queue.pop();
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+template<typename T, std::size_t N, EDF::QueueMode M = EDF::QueueMode::wrapped>
+static void QueueFillDrain( benchmark::State& state ) {
+    EDF::Queue<T, N, M> queue;
+    T value{};
+    for( auto _ : state ) {
+        while( !queue.isFull() ) {
+            queue.push( value );
+        }
+        while( !queue.isEmpty() ) {
+            value = queue.pop();
+        }
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2 * queue.maxLength(), sizeof(T) );
+}
+
+template<typename T, std::size_t N>
+static void QueueFillDrainBulk( benchmark::State& state ) {
+    EDF::Queue<T, N> queue;
+    T block[N - 1] = {};
+    // offset head/tail so every block move wraps
+    queue.push( block, N / 2 );
+    queue.pop( block, N / 2 );
+    for( auto _ : state ) {
+        queue.push( block, queue.maxLength() );
+        queue.pop( block, queue.maxLength() );
+        benchmark::DoNotOptimize( block );
+    }
+    Bench::reportPerOp( state, 2 * queue.maxLength(), sizeof(T) );
+}
+
+// Steady state of a full window: every push overwrites the oldest element
+template<typename T, std::size_t N>
+static void OverwriteQueuePush( benchmark::State& state ) {
+    EDF::OverwriteQueue<T, N> queue;
+    T value{};
+    while( !queue.isFull() ) {
+        queue.push( value );
+    }
+    for( auto _ : state ) {
+        queue.push( value );
+        value = queue.latest( N / 2 );
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+template<typename T, std::size_t N>
+static void SPSCQueuePushPop( benchmark::State& state ) {
+    static EDF::SPSCQueue<T, N> queue;
+    while( queue.length() < queue.maxLength() / 2 ) {
+        queue.push( T() );
+    }
+    T value{};
+    for( auto _ : state ) {
+        queue.push( value );
+        value = queue.pop();
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+// Every thread pushes then pops one element against the same queue, so all of them contend on head and tail
+template<typename T, std::size_t N>
+static void MPMCQueuePushPop( benchmark::State& state ) {
+    static EDF::MPMCQueue<T, N> queue;
+    T value{};
+    for( auto _ : state ) {
+        while( !queue.push( value ) ) {}
+        while( !queue.pop( value ) ) {}
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+// Baseline: the same traffic through a Queue guarded by a mutex
+template<typename T, std::size_t N>
+static void MutexQueuePushPop( benchmark::State& state ) {
+    static EDF::Queue<T, N> queue;
+    static std::mutex mutex;
+    T value{};
+    for( auto _ : state ) {
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            queue.push( value );
+        }
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            value = queue.pop();
+        }
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2, sizeof(T) );
+}
+
+static void QueuePop32be( benchmark::State& state ) {
+    EDF::Queue<std::uint8_t, 256> queue;
+    std::uint32_t value = 0;
+    for( auto _ : state ) {
+        for( std::uint8_t k = 0; k < 4; ++k ) {
+            queue.push( k );
+        }
+        value += queue.pop32be();
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 1, sizeof(value) );
+}
+
+namespace {
+struct Sample {
+    std::uint16_t id;
+    std::uint32_t timestamp;
+    std::int16_t axis[3];
+    float temperature;
+};
+
+using SampleLayout = EDF::Layout<Sample,
+    EDF::Field<&Sample::id>,
+    EDF::Field<&Sample::timestamp>,
+    EDF::Field<&Sample::axis, EDF::Endian::little>,
+    EDF::Field<&Sample::temperature>
+>;
+} /* namespace */
+
+// Baseline: decode the same frame field by field with the pop16be()/pop32be()... family
+static void QueueDecodePopFields( benchmark::State& state ) {
+    EDF::Queue<std::uint8_t, 256> queue;
+    std::uint8_t frame[SampleLayout::SIZE] = {};
+    Sample sample{};
+    for( auto _ : state ) {
+        queue.push( frame, sizeof(frame) );
+        sample.id = queue.pop16be();
+        sample.timestamp = queue.pop32be();
+        for( auto& axis : sample.axis ) {
+            axis = static_cast<std::int16_t>(queue.pop16le());
+        }
+        const std::uint32_t raw = queue.pop32be();
+        std::memcpy( &sample.temperature, &raw, sizeof(raw) );
+        benchmark::DoNotOptimize( sample );
+    }
+    Bench::reportPerOp( state, 1, SampleLayout::SIZE );
+}
+
+static void QueueDecodeReaderLayout( benchmark::State& state ) {
+    EDF::Queue<std::uint8_t, 256> queue;
+    std::uint8_t frame[SampleLayout::SIZE] = {};
+    Sample sample{};
+    for( auto _ : state ) {
+        queue.push( frame, sizeof(frame) );
+        EDF::QueueReader reader( queue );
+        reader.read<SampleLayout>( sample );
+        reader.commit();
+        benchmark::DoNotOptimize( sample );
+    }
+    Bench::reportPerOp( state, 1, SampleLayout::SIZE );
+}
+
+// Baseline: encode field by field with the push16be()/push32be()... family
+static void QueueEncodePushFields( benchmark::State& state ) {
+    EDF::Queue<std::uint8_t, 256> queue;
+    std::uint8_t frame[SampleLayout::SIZE] = {};
+    Sample sample{};
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( sample );
+        queue.push16be( sample.id );
+        queue.push32be( sample.timestamp );
+        for( auto& axis : sample.axis ) {
+            queue.push16le( static_cast<std::uint16_t>(axis) );
+        }
+        std::uint32_t raw = 0;
+        std::memcpy( &raw, &sample.temperature, sizeof(raw) );
+        queue.push32be( raw );
+        queue.pop( frame, sizeof(frame) );
+        benchmark::DoNotOptimize( frame );
+    }
+    Bench::reportPerOp( state, 1, SampleLayout::SIZE );
+}
+
+static void QueueEncodeWriterLayout( benchmark::State& state ) {
+    EDF::Queue<std::uint8_t, 256> queue;
+    std::uint8_t frame[SampleLayout::SIZE] = {};
+    Sample sample{};
+    for( auto _ : state ) {
+        benchmark::DoNotOptimize( sample );
+        EDF::QueueWriter writer( queue );
+        writer.write<SampleLayout>( sample );
+        writer.commit();
+        queue.pop( frame, sizeof(frame) );
+        benchmark::DoNotOptimize( frame );
+    }
+    Bench::reportPerOp( state, 1, SampleLayout::SIZE );
+}
+
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint8_t, 16 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint8_t, 100 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint8_t, 256 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint8_t, 1000 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint32_t, 16 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint32_t, 100 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( QueuePushPop, Bench::Payload32, 16 );
+BENCHMARK_TEMPLATE( QueuePushPop, Bench::Payload32, 100 );
+BENCHMARK_TEMPLATE( QueuePushPop, Bench::Payload32, 256 );
+
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint8_t, 256, EDF::QueueMode::freeRunning );
+BENCHMARK_TEMPLATE( QueuePushPop, std::uint32_t, 256, EDF::QueueMode::freeRunning );
+BENCHMARK_TEMPLATE( QueuePushPop, Bench::Payload32, 256, EDF::QueueMode::freeRunning );
+
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint8_t, 256 );
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint8_t, 255 );
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( QueueFillDrain, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( QueueFillDrain, Bench::Payload32, 60 );
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint8_t, 256, EDF::QueueMode::freeRunning );
+BENCHMARK_TEMPLATE( QueueFillDrain, std::uint32_t, 1024, EDF::QueueMode::freeRunning );
+BENCHMARK_TEMPLATE( QueueFillDrain, Bench::Payload32, 64, EDF::QueueMode::freeRunning );
+
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, std::uint8_t, 256 );
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, std::uint8_t, 255 );
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, std::uint32_t, 1000 );
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( QueueFillDrainBulk, Bench::Payload32, 60 );
+
+BENCHMARK_TEMPLATE( OverwriteQueuePush, std::uint16_t, 64 );
+BENCHMARK_TEMPLATE( OverwriteQueuePush, std::uint16_t, 100 );
+BENCHMARK_TEMPLATE( OverwriteQueuePush, Bench::Payload32, 64 );
+
+BENCHMARK_TEMPLATE( SPSCQueuePushPop, std::uint8_t, 256 );
+BENCHMARK_TEMPLATE( SPSCQueuePushPop, std::uint8_t, 1000 );
+BENCHMARK_TEMPLATE( SPSCQueuePushPop, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( SPSCQueuePushPop, Bench::Payload32, 64 );
+
+BENCHMARK_TEMPLATE( MPMCQueuePushPop, std::uint32_t, 1024 )->ThreadRange( 1, 16 )->UseRealTime();
+BENCHMARK_TEMPLATE( MPMCQueuePushPop, Bench::Payload32, 1024 )->ThreadRange( 1, 16 )->UseRealTime();
+BENCHMARK_TEMPLATE( MutexQueuePushPop, std::uint32_t, 1024 )->ThreadRange( 1, 16 )->UseRealTime();
+BENCHMARK_TEMPLATE( MutexQueuePushPop, Bench::Payload32, 1024 )->ThreadRange( 1, 16 )->UseRealTime();
+
+BENCHMARK( QueuePop32be );
+BENCHMARK( QueueDecodePopFields );
+BENCHMARK( QueueDecodeReaderLayout );
+BENCHMARK( QueueEncodePushFields );
+BENCHMARK( QueueEncodeWriterLayout );
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/Stack.hpp>
+
+// Fill the stack one element at a time, then empty it
+template<typename S, typename T, std::size_t N>
+static void StackPushPop( benchmark::State& state ) {
+    S stack;
+    for( auto _ : state ) {
+        for( std::size_t k = 0; k < N; ++k ) {
+            stack.push( T(static_cast<std::uint32_t>(k)) );
+        }
+        benchmark::DoNotOptimize( stack );
+        T value;
+        for( std::size_t k = 0; k < N; ++k ) {
+            value = stack.pop();
+        }
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2 * N, sizeof(T) );
+}
+
+// Same work as StackPushPop, as one pushN() and one popN()
+template<typename T, std::size_t N>
+static void StackPushNPopN( benchmark::State& state ) {
+    EDF::Stack<T, N> stack;
+    T values[N];
+    for( std::size_t k = 0; k < N; ++k ) {
+        values[k] = T(static_cast<std::uint32_t>(k));
+    }
+    for( auto _ : state ) {
+        stack.pushN( values, N );
+        benchmark::DoNotOptimize( stack );
+        stack.popN( values, N );
+        benchmark::DoNotOptimize( values );
+    }
+    Bench::reportPerOp( state, 2 * N, sizeof(T) );
+}
+
+// Same work as StackPushPop, with every push and pop a lock-free swap
+template<typename T, std::size_t N>
+static void AtomicStackPushPop( benchmark::State& state ) {
+    static EDF::AtomicStack<T, N> stack;
+    for( auto _ : state ) {
+        for( std::size_t k = 0; k < N; ++k ) {
+            stack.push( T(static_cast<std::uint32_t>(k)) );
+        }
+        T value;
+        for( std::size_t k = 0; k < N; ++k ) {
+            stack.pop( value );
+        }
+        benchmark::DoNotOptimize( value );
+    }
+    Bench::reportPerOp( state, 2 * N, sizeof(T) );
+}
+
+BENCHMARK_TEMPLATE( StackPushPop, EDF::Stack<std::uint32_t, 256>, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( StackPushPop, EDF::Stack<Bench::Payload32, 64>, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( StackPushNPopN, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( StackPushNPopN, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( AtomicStackPushPop, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( AtomicStackPushPop, Bench::Payload32, 64 );
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/String.hpp>
+
+namespace {
+constexpr char chunk[] = "0123456789abcdef";
+constexpr std::size_t chunkLength = sizeof(chunk) - 1;
+}
+
+template<std::size_t N>
+static void StringAppend( benchmark::State& state ) {
+    EDF::String<N> string;
+    for( auto _ : state ) {
+        string.clear();
+        while( string.length() + chunkLength <= string.maxLength() ) {
+            string.append( chunk, chunkLength );
+        }
+        benchmark::DoNotOptimize( string.asCString() );
+    }
+    Bench::reportPerOp( state, (N - 1) / chunkLength, chunkLength );
+}
+
+template<std::size_t N>
+static void StringAppendChar( benchmark::State& state ) {
+    EDF::String<N> string;
+    for( auto _ : state ) {
+        string.clear();
+        while( !string.isFull() ) {
+            string.append( 'x' );
+        }
+        benchmark::DoNotOptimize( string.asCString() );
+    }
+    Bench::reportPerOp( state, string.maxLength(), sizeof(char) );
+}
+
+template<std::size_t N>
+static void StringFindChar( benchmark::State& state ) {
+    EDF::String<N> string;
+    while( !string.isFull() ) {
+        string.append( 'a' );
+    }
+    string[string.length() - 1] = 'z';  // worst case, match is the last character
+    for( auto _ : state ) {
+        auto it = string.find( 'z' );
+        benchmark::DoNotOptimize( it );
+    }
+    Bench::reportPerOp( state, 1, string.length() );
+}
+
+template<std::size_t N>
+static void StringFindSubString( benchmark::State& state ) {
+    EDF::String<N> string;
+    while( !string.isFull() ) {
+        string.append( 'a' );
+    }
+    string[string.length() - 1] = 'b';  // "aab" only matches at the very end
+    for( auto _ : state ) {
+        auto it = string.find( "aab" );
+        benchmark::DoNotOptimize( it );
+    }
+    Bench::reportPerOp( state, 1, string.length() );
+}
+
+BENCHMARK_TEMPLATE( StringAppend, 64 );
+BENCHMARK_TEMPLATE( StringAppend, 100 );
+BENCHMARK_TEMPLATE( StringAppend, 256 );
+BENCHMARK_TEMPLATE( StringAppend, 1000 );
+
+BENCHMARK_TEMPLATE( StringAppendChar, 64 );
+BENCHMARK_TEMPLATE( StringAppendChar, 100 );
+BENCHMARK_TEMPLATE( StringAppendChar, 256 );
+
+BENCHMARK_TEMPLATE( StringFindChar, 64 );
+BENCHMARK_TEMPLATE( StringFindChar, 100 );
+BENCHMARK_TEMPLATE( StringFindChar, 256 );
+BENCHMARK_TEMPLATE( StringFindChar, 1000 );
+
+BENCHMARK_TEMPLATE( StringFindSubString, 64 );
+BENCHMARK_TEMPLATE( StringFindSubString, 256 );
+BENCHMARK_TEMPLATE( StringFindSubString, 1000 );
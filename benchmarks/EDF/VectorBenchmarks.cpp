@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "Benchmark.hpp"
+
+#include <EDF/SmallVector.hpp>
+#include <EDF/Vector.hpp>
+
+#include <new>
+#include <vector>
+
+namespace {
+// 8 byte trivially copyable record, EX: a decoded sensor sample
+struct SmallStruct {
+    std::uint16_t id;
+    std::uint8_t flags;
+    std::uint8_t level;
+    std::uint32_t value;
+};
+static_assert( sizeof(SmallStruct) == 8 );
+} /* anonymous */
+
+template<typename T, std::size_t N>
+static void VectorInsertEraseMiddle( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    while( vector.length() < vector.maxLength() / 2 ) {
+        vector.pushBack( T() );
+    }
+    const std::size_t middle = vector.length() / 2;
+    const T value{};
+    for( auto _ : state ) {
+        vector.insert( middle, value );
+        vector.erase( middle );
+        benchmark::DoNotOptimize( vector.data() );
+    }
+    // each operation shifts the upper half of the elements by one slot
+    Bench::reportPerOp( state, 2, (vector.length() - middle) * sizeof(T) );
+}
+
+// Insert and erase a block of 8 at the front, every element behind it shifts by 8 slots
+template<typename T, std::size_t N>
+static void VectorInsertEraseRangeFront( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    while( vector.length() < vector.maxLength() / 2 ) {
+        vector.pushBack( T() );
+    }
+    const T value{};
+    for( auto _ : state ) {
+        vector.insert( vector.begin(), 8, value );
+        vector.erase( vector.begin(), vector.begin() + 8 );
+        benchmark::DoNotOptimize( vector.data() );
+    }
+    Bench::reportPerOp( state, 2, vector.length() * sizeof(T) );
+}
+
+template<typename T, std::size_t N>
+static void VectorPushBackClear( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    const T value{};
+    for( auto _ : state ) {
+        while( !vector.isFull() ) {
+            vector.pushBack( value );
+        }
+        benchmark::DoNotOptimize( vector.data() );
+        vector.clear();
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// An empty vector never touches its storage, so the cost shouldn't depend on N
+template<typename T, std::size_t N>
+static void VectorConstructEmpty( benchmark::State& state ) {
+    // Constructed in place in static memory so stack probing of a large local doesn't get measured
+    alignas(EDF::Vector<T, N>) static unsigned char raw[sizeof(EDF::Vector<T, N>)];
+    for( auto _ : state ) {
+        auto* vector = new (raw) EDF::Vector<T, N>;
+        benchmark::DoNotOptimize( vector );
+        benchmark::ClobberMemory();
+        vector->~Vector();
+    }
+    Bench::reportPerOp( state, 1, 0 );
+}
+
+// Fill a vector from a block of samples, EX: an ADC DMA buffer
+template<typename T, std::size_t N>
+static void VectorFillPushBack( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    T block[N] = {};
+    for( auto _ : state ) {
+        vector.clear();
+        for( const T& sample : block ) {
+            vector.pushBack( sample );
+        }
+        benchmark::DoNotOptimize( vector.data() );
+        benchmark::ClobberMemory();
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+template<typename T, std::size_t N>
+static void VectorFillAppend( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    T block[N] = {};
+    for( auto _ : state ) {
+        vector.assign( block, block + N );
+        benchmark::DoNotOptimize( vector.data() );
+        benchmark::ClobberMemory();
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// The producer writes straight into the tail, no copy out of a staging buffer
+template<typename T, std::size_t N>
+static void VectorFillSpareCapacity( benchmark::State& state ) {
+    EDF::Vector<T, N> vector;
+    for( auto _ : state ) {
+        vector.clear();
+        auto spare = vector.spareCapacity();
+        for( std::size_t k = 0; k < spare.length(); ++k ) {
+            spare[k] = static_cast<T>(k);
+        }
+        vector.commit( spare.length() );
+        benchmark::DoNotOptimize( vector.data() );
+        benchmark::ClobberMemory();
+    }
+    Bench::reportPerOp( state, N, sizeof(T) );
+}
+
+// Build a short lived vector of Count elements, EX: a scratch list on a host tool. Count <= N never allocates
+template<typename T, std::size_t N, std::size_t Count>
+static void SmallVectorBuild( benchmark::State& state ) {
+    const T value{};
+    for( auto _ : state ) {
+        EDF::SmallVector<T, N> vector;
+        for( std::size_t k = 0; k < Count; ++k ) {
+            vector.pushBack( value );
+        }
+        benchmark::DoNotOptimize( vector.data() );
+        benchmark::ClobberMemory();
+    }
+    Bench::reportPerOp( state, Count, sizeof(T) );
+}
+
+template<typename T, std::size_t Count>
+static void StdVectorBuild( benchmark::State& state ) {
+    const T value{};
+    for( auto _ : state ) {
+        std::vector<T> vector;
+        for( std::size_t k = 0; k < Count; ++k ) {
+            vector.push_back( value );
+        }
+        benchmark::DoNotOptimize( vector.data() );
+        benchmark::ClobberMemory();
+    }
+    Bench::reportPerOp( state, Count, sizeof(T) );
+}
+
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint8_t, 64 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint8_t, 512 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint8_t, 500 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint32_t, 512 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, std::uint32_t, 500 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, Bench::Payload32, 60 );
+
+BENCHMARK_TEMPLATE( VectorInsertEraseMiddle, SmallStruct, 64 );
+BENCHMARK_TEMPLATE( VectorInsertEraseRangeFront, std::uint8_t, 512 );
+BENCHMARK_TEMPLATE( VectorInsertEraseRangeFront, SmallStruct, 64 );
+
+BENCHMARK_TEMPLATE( VectorPushBackClear, std::uint8_t, 512 );
+BENCHMARK_TEMPLATE( VectorPushBackClear, std::uint8_t, 500 );
+BENCHMARK_TEMPLATE( VectorPushBackClear, std::uint32_t, 256 );
+BENCHMARK_TEMPLATE( VectorPushBackClear, Bench::Payload32, 64 );
+BENCHMARK_TEMPLATE( VectorPushBackClear, SmallStruct, 64 );
+
+BENCHMARK_TEMPLATE( VectorConstructEmpty, std::uint32_t, 16 );
+BENCHMARK_TEMPLATE( VectorConstructEmpty, std::uint32_t, 1024 );
+BENCHMARK_TEMPLATE( VectorConstructEmpty, Bench::Payload32, 1024 );
+
+BENCHMARK_TEMPLATE( VectorFillPushBack, std::uint16_t, 256 );
+BENCHMARK_TEMPLATE( VectorFillAppend, std::uint16_t, 256 );
+BENCHMARK_TEMPLATE( VectorFillSpareCapacity, std::uint16_t, 256 );
+
+BENCHMARK_TEMPLATE( SmallVectorBuild, std::uint32_t, 16, 8 );
+BENCHMARK_TEMPLATE( StdVectorBuild, std::uint32_t, 8 );
+BENCHMARK_TEMPLATE( SmallVectorBuild, std::uint32_t, 16, 64 );
+BENCHMARK_TEMPLATE( StdVectorBuild, std::uint32_t, 64 );
+BENCHMARK_TEMPLATE( SmallVectorBuild, Bench::Payload32, 8, 8 );
+BENCHMARK_TEMPLATE( StdVectorBuild, Bench::Payload32, 8 );
@@ -173,6 +173,22 @@ int main( void ) {
     // end::uint8_t_pop64le[]
     std::cout << "data64le: 0x" << data64le << '\n';
 
+    // tag::uint8_t_push_be[]
+    q.push8be( 0x12 );                  // 0x12
+    q.push16be( 0x1234 );               // 0x12, 0x34
+    q.push32be( 0x12345678 );           // 0x12, 0x34, 0x56, 0x78
+    q.push64be( 0x123456789ABCDEF0 );   // 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0
+    // end::uint8_t_push_be[]
+    q.clear();
+
+    // tag::uint8_t_push_le[]
+    q.push8le( 0x12 );                  // 0x12
+    q.push16le( 0x1234 );               // 0x34, 0x12
+    q.push32le( 0x12345678 );           // 0x78, 0x56, 0x34, 0x12
+    q.push64le( 0x123456789ABCDEF0 );   // 0xF0, 0xDE, 0xBC, 0x9A, 0x78, 0x56, 0x34, 0x12
+    // end::uint8_t_push_le[]
+    q.clear();
+
     q.push( 0x12 );
     q.push( 0x34 );
     q.push( 0x56 );
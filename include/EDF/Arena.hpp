@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+#include "EDF/String.hpp"
+#include "EDF/Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace EDF {
+
+/*
+ * Bump allocator over Bytes of static storage, for scratch memory that is all freed at once, EX: per request
+ * or per frame. allocate() moves an offset forward, rewind() moves it back to a mark(), both are O(1).
+ * Nothing is freed on its own and no destructors are run, objects allocated after a mark must be done with
+ * before rewinding to it.
+ */
+template<std::size_t Bytes>
+class Arena final {
+private:
+    std::size_t offset;
+    std::size_t highWater;
+    union {
+        char unused;
+        alignas(std::max_align_t) unsigned char bytes[Bytes];
+    };
+public:
+    using Marker = std::size_t;
+
+    // Rewinds the arena to where it was when the Scope was created, when the Scope goes out of scope
+    class Scope final {
+    private:
+        Arena& arena;
+        Marker marker;
+    public:
+        explicit Scope( Arena& a ) : arena(a), marker(a.mark()) {}
+        ~Scope()                                                { arena.rewind( marker ); }
+        Scope( const Scope& ) = delete;
+        Scope& operator=( const Scope& ) = delete;
+    };
+
+    constexpr Arena() : offset(0), highWater(0), unused{} {}
+    ~Arena() = default;
+    Arena( const Arena& ) = delete;
+    Arena& operator=( const Arena& ) = delete;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                              const { return offset == 0; }
+    constexpr bool isFull()                               const { return offset == Bytes; }
+
+    /* Capacity */
+    // Number of bytes allocated, including padding for alignment
+    constexpr const std::size_t& length()                 const { return offset; }
+    constexpr std::size_t maxLength()                     const { return Bytes; }
+    constexpr std::size_t remaining()                     const { return Bytes - offset; }
+    // Most bytes ever allocated at the same time, to size Bytes from a test run
+    constexpr std::size_t highWaterMark()                 const { return highWater; }
+
+    /* Operations */
+    // size bytes aligned to alignment, or nullptr if they don't fit
+    void* allocate( std::size_t size, std::size_t alignment = alignof(std::max_align_t) );
+
+    // Uninitialized storage for count elements of T, or nullptr if they don't fit
+    template<typename T>
+    T* allocate( std::size_t count )                            { return static_cast<T*>(allocate( count * sizeof(T), alignof(T) )); }
+
+    constexpr Marker mark()                               const { return offset; }
+    constexpr void rewind( Marker marker )                      { EDF_ASSERTD(marker <= offset, "marker must come from mark() before the allocations being released"); offset = marker; }
+    constexpr void reset()                                      { offset = 0; }
+
+    Scope scope()                                               { return Scope( *this ); }
+};
+
+/*
+ * Vector with a capacity chosen at runtime, in storage taken from an Arena. Same iterator types as Vector,
+ * and the same element access, insert( pos, value ), emplace(), erase(), pushBack(), emplaceBack(), popBack(),
+ * assign(), append(), spareCapacity() and commit(). It doesn't have the count or initializer_list insert()
+ * overloads, or resize(). The storage is released when the arena is rewound, not when the ArenaVector
+ * is destroyed, so it must not outlive the Arena::Scope or mark() it was created in.
+ */
+template<typename T>
+class ArenaVector final {
+private:
+    T* elements;
+    std::size_t n;
+    std::size_t limit;
+public:
+    template<std::size_t Bytes>
+    ArenaVector( Arena<Bytes>& arena, std::size_t capacity );
+    ~ArenaVector()                                                                        { clear(); }
+    ArenaVector( const ArenaVector& ) = delete;
+    ArenaVector& operator=( const ArenaVector& ) = delete;
+
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    /* Current state */
+    constexpr bool isEmpty()                                                        const { return n == 0; }
+    constexpr bool isFull()                                                         const { return n == limit; }
+
+    /* Capacity */
+    constexpr const std::size_t& length()                                           const { return n; }
+    constexpr std::size_t maxLength()                                               const { return limit; }
+
+    /* Element access */
+    constexpr T& at( std::size_t index )                                                  { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return elements[index]; }
+    constexpr const T& at( std::size_t index )                                      const { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return elements[index]; }
+
+    constexpr T& operator[]( std::size_t index )                                          { return elements[index]; }
+    constexpr const T& operator[]( std::size_t index )                              const { return elements[index]; }
+
+    constexpr T& front()                                                                  { return at( 0 ); }
+    constexpr const T& front()                                                      const { return at( 0 ); }
+
+    constexpr T& back()                                                                   { return at( n - 1 ); }
+    constexpr const T& back()                                                       const { return at( n - 1 ); }
+
+    constexpr T* data()                                                                   { return elements; }
+    constexpr const T* data()                                                       const { return elements; }
+
+    /* Operations */
+    constexpr void clear()                                                                { std::destroy( begin(), end() ); n = 0; }
+
+    constexpr Iterator insert( ConstIterator pos, const T& value )                        { return emplace( pos, value ); }
+    constexpr Iterator insert( ConstIterator pos, T&& value )                             { return emplace( pos, std::move(value) ); }
+
+    template<typename... Args>
+    constexpr Iterator emplace( ConstIterator pos, Args&&... args );
+
+    constexpr Iterator erase( ConstIterator pos )                                         { return erase( pos, pos + 1 ); }
+    constexpr Iterator erase( ConstIterator first, ConstIterator last );
+
+    constexpr void pushBack( const T& value )                                             { emplaceBack( value ); }
+    constexpr void pushBack( T&& value )                                                  { emplaceBack( std::move(value) ); }
+
+    template<typename... Args>
+    constexpr T& emplaceBack( Args&&... args );
+
+    constexpr T popBack();
+
+    /* Bulk Operations */
+    template<typename InputIt>
+    constexpr void assign( InputIt first, InputIt last )                                  { clear(); append( first, last ); }
+    template<typename InputIt>
+    constexpr void append( InputIt first, InputIt last );
+
+    constexpr Span<T> spareCapacity()                                                     { return Span<T>( data() + n, limit - n ); }
+    constexpr void commit( std::size_t count );
+
+    /* Iterators */
+    constexpr Iterator begin()                                                            { return Iterator( data() ); }
+    constexpr ConstIterator begin()                                                 const { return ConstIterator( data() ); }
+    constexpr ConstIterator cbegin()                                                const { return ConstIterator( data() ); }
+
+    constexpr Iterator end()                                                              { return Iterator( data() + n ); }
+    constexpr ConstIterator end()                                                   const { return ConstIterator( data() + n ); }
+    constexpr ConstIterator cend()                                                  const { return ConstIterator( data() + n ); }
+
+    constexpr ReverseIterator rbegin()                                                    { return ReverseIterator( end() ); }
+    constexpr ConstReverseIterator rbegin()                                         const { return ConstReverseIterator( end() ); }
+    constexpr ConstReverseIterator crbegin()                                        const { return ConstReverseIterator( end() ); }
+
+    constexpr ReverseIterator rend()                                                      { return ReverseIterator( begin() ); }
+    constexpr ConstReverseIterator rend()                                           const { return ConstReverseIterator( begin() ); }
+    constexpr ConstReverseIterator crend()                                          const { return ConstReverseIterator( begin() ); }
+};
+
+/*
+ * String with a capacity chosen at runtime, in storage taken from an Arena. Built on the same implementation
+ * as String, so it behaves the same for the member functions it has. Like ArenaVector, it must not outlive
+ * the Arena::Scope or mark() it was created in.
+ */
+class ArenaString final {
+private:
+    char* buffer;
+    std::size_t size;
+    std::size_t N;      // bytes in buffer, including the terminating '\0'
+public:
+    template<std::size_t Bytes>
+    ArenaString( Arena<Bytes>& arena, std::size_t maxLength );
+    ~ArenaString() = default;
+    ArenaString( const ArenaString& ) = delete;
+    ArenaString& operator=( const ArenaString& ) = delete;
+
+    using Iterator = impl::Iterator;
+    using ConstIterator = impl::ConstIterator;
+
+    /* Is Questions */
+    bool isEmpty()                                              const { return size == 0; }
+    bool isFull()                                               const { return size == (N - 1); }
+
+    /* Capacity */
+    const std::size_t& length()                                 const { return size; }
+    std::size_t maxLength()                                     const { return N - 1; }
+
+    /* Element access */
+    char& at( std::size_t index )                                     { EDF_ASSERTD(index < size, "index needs to be within bounds of valid characters"); return buffer[index]; }
+    const char& at( std::size_t index )                         const { EDF_ASSERTD(index < size, "index needs to be within bounds of valid characters"); return buffer[index]; }
+
+    char& operator[]( std::size_t index )                             { return buffer[index]; }
+    const char& operator[]( std::size_t index )                 const { return buffer[index]; }
+
+    char* asCString()                                                 { return buffer; }
+    const char* asCString()                                     const { return buffer; }
+
+    /* Conversions: toX */
+    int32_t toInt32_t( int base = 10 )                          const { return impl::toInt32_t( buffer, size, base ); }
+    int64_t toInt64_t( int base = 10 )                          const { return impl::toInt64_t( buffer, size, base ); }
+    uint32_t toUint32_t( int base = 10 )                        const { return impl::toUint32_t( buffer, size, base ); }
+    uint64_t toUint64_t( int base = 10 )                        const { return impl::toUint64_t( buffer, size, base ); }
+
+    /* Operations */
+    ArenaString& append( const char* str )                            { return append( str, std::strlen( str ) ); }
+    ArenaString& append( const char* str, std::size_t n )             { impl::insert( buffer, size, N, end(), str, n ); return *this; }
+    ArenaString& append( char ch )                                    { impl::insert( buffer, size, N, end(), ch ); return *this; }
+    ArenaString& append( int32_t value, int base = 10 )               { return append( String<32+1>( value, base ) ); }
+    ArenaString& append( int64_t value, int base = 10 )               { return append( String<64+1>( value, base ) ); }
+    ArenaString& append( uint32_t value, int base = 10 )              { return append( String<32+1>( value, base ) ); }
+    ArenaString& append( uint64_t value, int base = 10 )              { return append( String<64+1>( value, base ) ); }
+    template<std::size_t S>
+    ArenaString& append( const String<S>& str )                       { return append( str.asCString(), str.length() ); }
+
+    Iterator insert( ConstIterator pos, const char* str, std::size_t n )  { return impl::insert( buffer, size, N, pos, str, n ); }
+    Iterator erase( ConstIterator first, ConstIterator last )             { return impl::erase( buffer, size, N, first, last ); }
+    void clear()                                                      { impl::make_string( buffer, size, N ); }
+
+    Iterator find( char value )                                 const { return impl::find( buffer, size, N, begin(), value ); }
+    Iterator find( const char* value )                          const { return impl::find( buffer, size, N, begin(), value, std::strlen( value ) ); }
+    bool contains( char value )                                 const { return find( value ) != end(); }
+    bool contains( const char* value )                          const { return find( value ) != end(); }
+
+    bool equals( const char* value )                            const { return impl::equals( buffer, size, N, value, std::strlen( value ) ); }
+    template<std::size_t S>
+    bool equals( const String<S>& value )                       const { return impl::equals( buffer, size, N, value.asCString(), value.length() ); }
+
+    ArenaString& trim( char value = '\0' )                            { impl::trimLeft( buffer, size, N, value ); impl::trimRight( buffer, size, N, value ); return *this; }
+    ArenaString& toLower()                                            { impl::toLower( buffer, size, N ); return *this; }
+    ArenaString& toUpper()                                            { impl::toUpper( buffer, size, N ); return *this; }
+
+    /* Iterators */
+    Iterator begin()                                                  { return Iterator( buffer ); }
+    ConstIterator begin()                                       const { return ConstIterator( buffer ); }
+    Iterator end()                                                    { return Iterator( buffer + size ); }
+    ConstIterator end()                                         const { return ConstIterator( buffer + size ); }
+};
+
+} /* EDF */
+
+#include "EDF/src/Arena.tpp"
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace EDF {
+
+/*
+ * Fixed number of bits, for masks wider than a BitField, EX: channel masks, free slot maps or GPIO snapshots.
+ * Bits are stored 64 to a word, and count(), the searches and the set operations work a word at a time.
+ * Bits past N are always 0.
+ */
+template<std::size_t N>
+class BitSet final {
+    static_assert( N > 0, "N must be greater than 0" );
+public:
+    static constexpr std::size_t BITS_PER_WORD = 64;
+    static constexpr std::size_t WORDS = (N + BITS_PER_WORD - 1) / BITS_PER_WORD;
+private:
+    Array<uint64_t, WORDS> words;
+
+    // Bits of the last word that are part of the set
+    static constexpr uint64_t TAIL_MASK = ((N % BITS_PER_WORD) == 0) ? ~uint64_t{0} : ((uint64_t{1} << (N % BITS_PER_WORD)) - 1);
+
+    static constexpr uint64_t bit( std::size_t index ) { return uint64_t{1} << (index % BITS_PER_WORD); }
+    // Index of the first set bit at or after word wordIndex, given that word's bits are pending
+    constexpr std::size_t findFrom( std::size_t wordIndex, uint64_t pending ) const;
+public:
+    constexpr BitSet() : words{} {}
+    ~BitSet() = default;
+
+    /* Is Questions */
+    constexpr bool test( std::size_t index )                const { EDF_ASSERTD(index < N, "index must be less than N"); return (words[index / BITS_PER_WORD] & bit( index )) != 0; }
+    constexpr bool any()                                    const;
+    constexpr bool none()                                   const { return !any(); }
+    constexpr bool all()                                    const;
+
+    /* Capacity */
+    constexpr std::size_t size()                            const { return N; }
+    // Number of set bits
+    constexpr std::size_t count()                           const;
+
+    /* Element access */
+    constexpr uint64_t word( std::size_t index )            const { EDF_ASSERTD(index < WORDS, "index must be less than WORDS"); return words[index]; }
+
+    /* Operations */
+    constexpr BitSet& set( std::size_t index )                    { EDF_ASSERTD(index < N, "index must be less than N"); words[index / BITS_PER_WORD] |= bit( index ); return *this; }
+    constexpr BitSet& set( std::size_t index, bool value )        { return value ? set( index ) : reset( index ); }
+    constexpr BitSet& reset( std::size_t index )                  { EDF_ASSERTD(index < N, "index must be less than N"); words[index / BITS_PER_WORD] &= ~bit( index ); return *this; }
+    constexpr BitSet& flip( std::size_t index )                   { EDF_ASSERTD(index < N, "index must be less than N"); words[index / BITS_PER_WORD] ^= bit( index ); return *this; }
+
+    constexpr BitSet& setAll();
+    constexpr BitSet& resetAll();
+    constexpr BitSet& flipAll();
+
+    // Index of the first set bit, or N if there isn't one
+    constexpr std::size_t findFirstSet()                    const { return findFrom( 0, words[0] ); }
+    // Index of the first set bit after index, or N if there isn't one. EX: for( i = findFirstSet(); i < N; i = findNextSet( i ) )
+    constexpr std::size_t findNextSet( std::size_t index )  const;
+    // Index of the first bit that isn't set, or N if they all are
+    constexpr std::size_t findFirstReset()                  const;
+
+    constexpr BitSet& operator&=( const BitSet& other );
+    constexpr BitSet& operator|=( const BitSet& other );
+    constexpr BitSet& operator^=( const BitSet& other );
+    constexpr BitSet operator~()                            const { BitSet result( *this ); return result.flipAll(); }
+
+    friend constexpr BitSet operator&( const BitSet& lhs, const BitSet& rhs ) { BitSet result( lhs ); result &= rhs; return result; }
+    friend constexpr BitSet operator|( const BitSet& lhs, const BitSet& rhs ) { BitSet result( lhs ); result |= rhs; return result; }
+    friend constexpr BitSet operator^( const BitSet& lhs, const BitSet& rhs ) { BitSet result( lhs ); result ^= rhs; return result; }
+
+    friend constexpr bool operator==( const BitSet& lhs, const BitSet& rhs ) {
+        for( std::size_t i = 0; i < WORDS; ++i ) {
+            if( lhs.words[i] != rhs.words[i] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=( const BitSet& lhs, const BitSet& rhs ) { return !(lhs == rhs); }
+};
+
+} /* EDF */
+
+#include "EDF/src/BitSet.tpp"
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace EDF {
+
+// tag::endian[]
+enum class Endian {
+    big,
+    little,
+};
+// end::endian[]
+
+namespace impl {
+template<std::size_t Bytes> struct UnsignedOfSize;
+template<> struct UnsignedOfSize<1> { using Type = std::uint8_t; };
+template<> struct UnsignedOfSize<2> { using Type = std::uint16_t; };
+template<> struct UnsignedOfSize<4> { using Type = std::uint32_t; };
+template<> struct UnsignedOfSize<8> { using Type = std::uint64_t; };
+
+template<typename T>
+using UnsignedOf = typename UnsignedOfSize<sizeof(T)>::Type;
+
+template<typename T>
+constexpr bool isSerializable = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+// Written as one expression per byte so the compiler merges it into a single (byte swapped) load
+template<typename U, Endian E, std::size_t... I>
+constexpr U assemble( const std::uint8_t* bytes, std::index_sequence<I...> ) {
+    if constexpr( E == Endian::big ) {
+        return static_cast<U>( ((static_cast<U>(bytes[I]) << (8 * (sizeof(U) - 1 - I))) | ...) );
+    }
+    else {
+        return static_cast<U>( ((static_cast<U>(bytes[I]) << (8 * I)) | ...) );
+    }
+}
+
+// Written as one expression per byte so the compiler merges it into a single (byte swapped) store
+template<typename U, Endian E, std::size_t... I>
+constexpr void disassemble( std::uint8_t* bytes, U value, std::index_sequence<I...> ) {
+    if constexpr( E == Endian::big ) {
+        ((bytes[I] = static_cast<std::uint8_t>(value >> (8 * (sizeof(U) - 1 - I)))), ...);
+    }
+    else {
+        ((bytes[I] = static_cast<std::uint8_t>(value >> (8 * I))), ...);
+    }
+}
+} /* impl */
+
+/* Read a T stored as sizeof(T) bytes in E byte order. T is an integer, enum, float, or double */
+template<typename T, Endian E>
+constexpr T load( const std::uint8_t* bytes ) {
+    static_assert( impl::isSerializable<T>, "load() requires an arithmetic or enum type" );
+    using U = impl::UnsignedOf<T>;
+    U value = impl::assemble<U, E>( bytes, std::make_index_sequence<sizeof(U)>{} );
+    if constexpr( std::is_floating_point_v<T> ) {
+        T result;
+        std::memcpy( &result, &value, sizeof(T) );
+        return result;
+    }
+    else {
+        return static_cast<T>(value);
+    }
+}
+
+/* Write value as sizeof(T) bytes in E byte order. T is an integer, enum, float, or double */
+template<typename T, Endian E>
+constexpr void store( std::uint8_t* bytes, const T& value ) {
+    static_assert( impl::isSerializable<T>, "store() requires an arithmetic or enum type" );
+    using U = impl::UnsignedOf<T>;
+    U raw{};
+    if constexpr( std::is_floating_point_v<T> ) {
+        std::memcpy( &raw, &value, sizeof(T) );
+    }
+    else {
+        raw = static_cast<U>(value);
+    }
+    impl::disassemble<U, E>( bytes, raw, std::make_index_sequence<sizeof(U)>{} );
+}
+
+template<typename T>
+constexpr T loadBe( const std::uint8_t* bytes )             { return load<T, Endian::big>( bytes ); }
+template<typename T>
+constexpr T loadLe( const std::uint8_t* bytes )             { return load<T, Endian::little>( bytes ); }
+
+template<typename T>
+constexpr void storeBe( std::uint8_t* bytes, const T& value ) { store<T, Endian::big>( bytes, value ); }
+template<typename T>
+constexpr void storeLe( std::uint8_t* bytes, const T& value ) { store<T, Endian::little>( bytes, value ); }
+
+} /* EDF */
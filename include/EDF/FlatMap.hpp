@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/Assert.hpp"
+#include "EDF/Vector.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+namespace EDF {
+
+template<typename K, typename V>
+struct KeyValue {
+    K key;
+    V value;
+};
+
+namespace impl {
+// First element in [first, first + length) for which less( element, key ) is false.
+// The loop count only depends on length, and the compare picks between two pointers, which compiles to a
+// conditional move instead of a branch the CPU has to guess.
+template<typename T, typename Key, typename Less>
+constexpr const T* lowerBound( const T* first, std::size_t length, const Key& key, Less less );
+
+// Merges the sorted [first, last) into the sorted elements, from the back, in one pass
+template<typename T, std::size_t N, typename BidirIt, typename Less>
+constexpr void insertSorted( Vector<T, N>& elements, BidirIt first, BidirIt last, Less less );
+} /* impl */
+
+/*
+ * Map kept as a sorted EDF::Vector of key/value pairs, for small, read-mostly tables where a binary search
+ * over contiguous memory beats hashing. Insert and erase shift the entries after them, O(n).
+ */
+template<typename K, typename V, std::size_t N, typename Compare = std::less<K>>
+class FlatMap final {
+public:
+    using Entry = KeyValue<K, V>;
+private:
+    Vector<Entry, N> entries;
+
+    // Function objects rather than functions, so the compare is inlined into the search loop
+    struct LessKey {
+        constexpr bool operator()( const Entry& entry, const K& key )        const { return Compare{}( entry.key, key ); }
+        constexpr bool operator()( const Entry& lhs, const Entry& rhs )      const { return Compare{}( lhs.key, rhs.key ); }
+    };
+    template<typename Value>
+    constexpr V& assign( const K& key, Value&& value );
+public:
+    using Iterator = typename Vector<Entry, N>::Iterator;
+    using ConstIterator = typename Vector<Entry, N>::ConstIterator;
+
+    constexpr FlatMap() = default;
+    ~FlatMap() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                    const { return entries.isEmpty(); }
+    constexpr bool isFull()                                     const { return entries.isFull(); }
+    constexpr bool contains( const K& key )                     const { return find( key ) != nullptr; }
+
+    /* Capacity */
+    constexpr const std::size_t& length()                       const { return entries.length(); }
+    constexpr std::size_t maxLength()                           const { return entries.maxLength(); }
+
+    /* Element access */
+    // nullptr if key isn't in the map
+    constexpr V* find( const K& key );
+    constexpr const V* find( const K& key )                     const;
+
+    constexpr V& at( const K& key )                                   { V* value = find( key ); EDF_ASSERTD(value != nullptr, "key must be in the map"); return *value; }
+    constexpr const V& at( const K& key )                       const { const V* value = find( key ); EDF_ASSERTD(value != nullptr, "key must be in the map"); return *value; }
+
+    /* Operations */
+    // First entry whose key isn't less than key
+    constexpr Iterator lowerBound( const K& key )                     { return begin() + (static_cast<const FlatMap&>(*this).lowerBound( key ) - cbegin()); }
+    constexpr ConstIterator lowerBound( const K& key )          const { return impl::lowerBound( entries.data(), length(), key, LessKey{} ); }
+
+    // Adds key, or replaces its value if it's already in the map
+    constexpr V& insert( const K& key, const V& value )               { return assign( key, value ); }
+    constexpr V& insert( const K& key, V&& value )                    { return assign( key, std::move(value) ); }
+
+    // Constructs the value from args... if key isn't in the map yet, else returns the existing value untouched
+    template<typename... Args>
+    constexpr V& emplace( const K& key, Args&&... args );
+
+    // Returns false if key isn't in the map
+    constexpr bool erase( const K& key );
+
+    // [first, last) must be sorted by key, and none of its keys can already be in the map
+    template<typename BidirIt>
+    constexpr void insertSorted( BidirIt first, BidirIt last )        { impl::insertSorted( entries, first, last, LessKey{} ); }
+
+    constexpr void clear()                                            { entries.clear(); }
+
+    /* Iterators */
+    constexpr Iterator begin()                                        { return entries.begin(); }
+    constexpr ConstIterator begin()                             const { return entries.begin(); }
+    constexpr ConstIterator cbegin()                            const { return entries.cbegin(); }
+
+    constexpr Iterator end()                                          { return entries.end(); }
+    constexpr ConstIterator end()                               const { return entries.end(); }
+    constexpr ConstIterator cend()                              const { return entries.cend(); }
+};
+
+/*
+ * Set kept as a sorted EDF::Vector, same trade offs as FlatMap. Elements can't be modified in place,
+ * that could break the order.
+ */
+template<typename K, std::size_t N, typename Compare = std::less<K>>
+class FlatSet final {
+private:
+    Vector<K, N> keys;
+
+    static constexpr bool less( const K& lhs, const K& rhs ) { return Compare{}( lhs, rhs ); }
+public:
+    using ConstIterator = typename Vector<K, N>::ConstIterator;
+
+    constexpr FlatSet() = default;
+    ~FlatSet() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                    const { return keys.isEmpty(); }
+    constexpr bool isFull()                                     const { return keys.isFull(); }
+    constexpr bool contains( const K& key )                     const { ConstIterator it = lowerBound( key ); return (it != end()) && !less( key, *it ); }
+
+    /* Capacity */
+    constexpr const std::size_t& length()                       const { return keys.length(); }
+    constexpr std::size_t maxLength()                           const { return keys.maxLength(); }
+
+    /* Operations */
+    // First key that isn't less than key
+    constexpr ConstIterator lowerBound( const K& key )          const { return impl::lowerBound( keys.data(), length(), key, Compare{} ); }
+
+    // Returns false if key is already in the set
+    constexpr bool insert( const K& key );
+    // Returns false if key isn't in the set
+    constexpr bool erase( const K& key );
+
+    // [first, last) must be sorted, and none of its keys can already be in the set
+    template<typename BidirIt>
+    constexpr void insertSorted( BidirIt first, BidirIt last )        { impl::insertSorted( keys, first, last, Compare{} ); }
+
+    constexpr void clear()                                            { keys.clear(); }
+
+    /* Iterators */
+    constexpr ConstIterator begin()                             const { return keys.begin(); }
+    constexpr ConstIterator cbegin()                            const { return keys.cbegin(); }
+    constexpr ConstIterator end()                               const { return keys.end(); }
+    constexpr ConstIterator cend()                              const { return keys.cend(); }
+};
+
+/*
+ * FlatMap with exactly N entries, sorted by its constructor. Can be built and searched at compile time,
+ * EX: a command or named color table with no startup cost. K and V need to be default constructible.
+ */
+template<typename K, typename V, std::size_t N, typename Compare = std::less<K>>
+class ConstFlatMap final {
+public:
+    using Entry = KeyValue<K, V>;
+private:
+    Array<Entry, N> entries;
+
+    struct LessKey {
+        constexpr bool operator()( const Entry& entry, const K& key ) const { return Compare{}( entry.key, key ); }
+    };
+public:
+    using ConstIterator = typename Array<Entry, N>::ConstIterator;
+
+    // Entries can be listed in any order, keys must be unique
+    constexpr ConstFlatMap( const Entry (&list)[N] );
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                    const { return N == 0; }
+    constexpr bool contains( const K& key )                     const { return find( key ) != nullptr; }
+
+    /* Capacity */
+    constexpr std::size_t length()                              const { return N; }
+    constexpr std::size_t maxLength()                           const { return N; }
+
+    /* Element access */
+    // nullptr if key isn't in the map
+    constexpr const V* find( const K& key )                     const;
+    constexpr const V& at( const K& key )                       const { const V* value = find( key ); EDF_ASSERTD(value != nullptr, "key must be in the map"); return *value; }
+
+    /* Operations */
+    constexpr ConstIterator lowerBound( const K& key )          const { return impl::lowerBound( entries.data(), N, key, LessKey{} ); }
+
+    /* Iterators */
+    constexpr ConstIterator begin()                             const { return entries.begin(); }
+    constexpr ConstIterator cbegin()                            const { return entries.cbegin(); }
+    constexpr ConstIterator end()                               const { return entries.end(); }
+    constexpr ConstIterator cend()                              const { return entries.cend(); }
+};
+
+/*
+ * FlatSet with exactly N keys, sorted by its constructor. Can be built and searched at compile time.
+ */
+template<typename K, std::size_t N, typename Compare = std::less<K>>
+class ConstFlatSet final {
+private:
+    Array<K, N> keys;
+
+    static constexpr bool less( const K& lhs, const K& rhs ) { return Compare{}( lhs, rhs ); }
+public:
+    using ConstIterator = typename Array<K, N>::ConstIterator;
+
+    // Keys can be listed in any order, and must be unique
+    constexpr ConstFlatSet( const K (&list)[N] );
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                    const { return N == 0; }
+    constexpr bool contains( const K& key )                     const { ConstIterator it = lowerBound( key ); return (it != end()) && !less( key, *it ); }
+
+    /* Capacity */
+    constexpr std::size_t length()                              const { return N; }
+    constexpr std::size_t maxLength()                           const { return N; }
+
+    /* Operations */
+    constexpr ConstIterator lowerBound( const K& key )          const { return impl::lowerBound( keys.data(), N, key, Compare{} ); }
+
+    /* Iterators */
+    constexpr ConstIterator begin()                             const { return keys.begin(); }
+    constexpr ConstIterator cbegin()                            const { return keys.cbegin(); }
+    constexpr ConstIterator end()                               const { return keys.end(); }
+    constexpr ConstIterator cend()                              const { return keys.cend(); }
+};
+
+// Deduces N from the list, EX: makeConstFlatMap<std::string_view, Color>( { { "red", Color::red() }, ... } )
+template<typename K, typename V, std::size_t N>
+constexpr ConstFlatMap<K, V, N> makeConstFlatMap( const KeyValue<K, V> (&list)[N] ) { return ConstFlatMap<K, V, N>( list ); }
+
+template<typename K, std::size_t N>
+constexpr ConstFlatSet<K, N> makeConstFlatSet( const K (&list)[N] ) { return ConstFlatSet<K, N>( list ); }
+
+} /* EDF */
+
+#include "EDF/src/FlatMap.tpp"
@@ -7,21 +7,38 @@
 
 #pragma once
 
+#include "EDF/Span.hpp"
 #include "EDF/Vector.hpp"
 
 #include <functional> // for std::less and std::greater
 
 namespace EDF {
 
-template<typename T, std::size_t N, typename Compare>
+/*
+ * D is the number of children per node. A larger D makes the tree shallower, and the D children
+ * compared at each level sit next to each other, EX: 4 uint32_t or 8 uint64_t fill a cache line.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D = 2>
 class Heap final {
 private:
+    static_assert( D >= 2, "Heap needs at least 2 children per node" );
     Vector<T, N> heap;
+    Compare compare;
 private:
-    constexpr void bubbleUp( std::size_t index );
-    constexpr void bubbleDown( std::size_t index );
+    // Move the hole towards the root/leaves until value fits there, returns where value belongs
+    constexpr std::size_t siftUp( std::size_t hole, const T& value );
+    constexpr std::size_t siftDown( std::size_t hole, const T& value, std::size_t n );
+    template<typename U>
+    constexpr std::size_t place( U&& value );
+    constexpr void heapify( std::size_t first );
+    static constexpr std::size_t depth( std::size_t n );
+
+    template<typename, std::size_t, typename, std::size_t>
+    friend class Heap;
 public:
-    constexpr Heap() = default;
+    constexpr Heap() : heap{}, compare{} {}
+    // Compare may hold state, EX: ordering deadlines relative to "now"
+    constexpr explicit Heap( const Compare& c ) : heap{}, compare(c) {}
     template<typename... I>
     constexpr Heap( I... iList );
     ~Heap() = default;
@@ -47,16 +64,39 @@ public:
     constexpr T pop();
 
     constexpr void clear()                        { heap.clear(); }
+
+    /* Ordered Access */
+    // Writes copies of the first k elements in pop order to out, without modifying the heap. k must be <= K
+    template<std::size_t K = 16, typename OutputIt>
+    constexpr OutputIt topK( std::size_t k, OutputIt out ) const;
+
+    // Sorts the elements in place into pop order, which is still a valid heap
+    constexpr Span<const T> sortInto();
+
+    /* Bulk Operations */
+    // Replaces the contents with [first, last) in O(n)
+    template<typename InputIt>
+    constexpr void assign( InputIt first, InputIt last );
+
+    // Appends [first, last), then either sifts each new element up or re-heapifies everything, whichever is cheaper
+    template<typename ForwardIt>
+    constexpr void pushBatch( ForwardIt first, ForwardIt last );
+
+    template<std::size_t M, std::size_t E>
+    constexpr void merge( const Heap<T, M, Compare, E>& other )   { pushBatch( other.heap.begin(), other.heap.end() ); }
+
+    constexpr Compare& comparator()               { return compare; }
+    constexpr const Compare& comparator()   const { return compare; }
 };
 
 // tag::declare_heap_max[]
-template<typename T, std::size_t N>
-using HeapMax = Heap<T, N, std::greater<T>>;
+template<typename T, std::size_t N, std::size_t D = 2>
+using HeapMax = Heap<T, N, std::greater<T>, D>;
 // end::declare_heap_max[]
 
 // tag::declare_heap_min[]
-template<typename T, std::size_t N>
-using HeapMin = Heap<T, N, std::less<T>>;
+template<typename T, std::size_t N, std::size_t D = 2>
+using HeapMin = Heap<T, N, std::less<T>, D>;
 // end::declare_heap_min[]
 
 } /* EDF */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Vector.hpp"
+
+#include <functional> // for std::less and std::greater
+
+namespace EDF {
+
+/*
+ * Binary heap where push() returns a stable handle to the element.
+ * The handle can be used to change the element's value, or remove it, in O(log n) while it's in the heap.
+ * A handle is released when its element is popped or erased, and may then be returned by a later push().
+ */
+template<typename T, std::size_t N, typename Compare>
+class IndexedHeap final {
+public:
+    using Handle = std::size_t;
+    static constexpr Handle INVALID_HANDLE = N;
+private:
+    Vector<T, N> heap;
+    // Left uninitialized like Vector's storage, so construction is O(1). Only entries below heap.length()
+    // and unusedHandle are ever read, and those have been written
+    union {
+        char noHandles;
+        Handle handleOf[N];         // heap index -> handle
+    };
+    union {
+        char noIndexes;
+        std::size_t indexOf[N];     // handle -> heap index, or the next free handle if the handle isn't in use
+    };
+    Handle freeHandle;
+    Handle unusedHandle;            // handles >= this one have never been given out
+    Compare compare;
+private:
+    constexpr Handle acquireHandle();
+    constexpr void releaseHandle( Handle handle );
+
+    constexpr std::size_t siftUp( std::size_t hole, const T& value );
+    constexpr std::size_t siftDown( std::size_t hole, const T& value );
+    constexpr void settle( std::size_t index, Handle handle );
+    template<typename U>
+    constexpr Handle place( U&& value );
+    constexpr T removeAt( std::size_t index );
+public:
+    constexpr IndexedHeap() : heap{}, noHandles(0), noIndexes(0), freeHandle(INVALID_HANDLE), unusedHandle(0), compare{} {}
+    constexpr explicit IndexedHeap( const Compare& c ) : heap{}, noHandles(0), noIndexes(0), freeHandle(INVALID_HANDLE), unusedHandle(0), compare(c) {}
+    ~IndexedHeap() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                const { return heap.isEmpty(); }
+    constexpr bool isFull()                 const { return heap.isFull(); }
+    constexpr bool contains( Handle handle ) const;
+
+    /* Capacity */
+    constexpr const std::size_t& length()   const { return heap.length(); }
+    constexpr std::size_t maxLength()       const { return heap.maxLength(); }
+
+    /* Element access */
+    // Read only, use update() to change an element's value
+    constexpr const T& at( Handle handle )  const;
+    constexpr const T& operator[]( Handle handle ) const { return heap[indexOf[handle]]; }
+
+    /* Operations */
+    constexpr const T& peek()               const { return heap.front(); }
+    constexpr Handle peekHandle()           const { EDF_ASSERTD( !isEmpty(), "IndexedHeap must not be empty in order to use peekHandle()" ); return handleOf[0]; }
+
+    constexpr Handle push( const T& value );
+    constexpr Handle push( T&& value );
+
+    template<typename... Args>
+    constexpr Handle emplace( Args&&... args );
+
+    constexpr T pop();
+
+    constexpr void update( Handle handle, const T& value );
+    constexpr void update( Handle handle, T&& value );
+
+    constexpr T erase( Handle handle );
+
+    constexpr void clear();
+
+    constexpr Compare& comparator()               { return compare; }
+    constexpr const Compare& comparator()   const { return compare; }
+};
+
+// tag::declare_indexed_heap_max[]
+template<typename T, std::size_t N>
+using IndexedHeapMax = IndexedHeap<T, N, std::greater<T>>;
+// end::declare_indexed_heap_max[]
+
+// tag::declare_indexed_heap_min[]
+template<typename T, std::size_t N>
+using IndexedHeapMin = IndexedHeap<T, N, std::less<T>>;
+// end::declare_indexed_heap_min[]
+
+} /* EDF */
+
+#include "EDF/src/IndexedHeap.tpp"
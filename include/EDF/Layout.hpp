@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/Endian.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Compile time description of a fixed size binary layout, mapped onto the members of a struct.
+ *
+ *   struct Header { uint8_t id; uint16_t length; };
+ *   struct Packet { Header header; float temperature; int16_t samples[4]; };
+ *
+ *   using HeaderLayout = EDF::Layout<Header,
+ *       EDF::Field<&Header::id>,
+ *       EDF::Field<&Header::length, EDF::Endian::little>>;
+ *
+ *   using PacketLayout = EDF::Layout<Packet,
+ *       EDF::Nested<&Packet::header, HeaderLayout>,
+ *       EDF::Padding<1>,
+ *       EDF::Field<&Packet::temperature>,
+ *       EDF::Field<&Packet::samples>>;
+ *
+ *   static_assert( PacketLayout::SIZE == 16 );
+ */
+
+namespace EDF {
+
+namespace impl {
+template<typename M> struct MemberPointer;
+template<typename C, typename M>
+struct MemberPointer<M C::*> {
+    using Class = C;
+    using Type = M;
+};
+
+// Element type and count of a member that is a single value, T[K], or EDF::Array<T, K>
+template<typename M>
+struct FieldShape {
+    using Element = M;
+    static constexpr std::size_t COUNT = 1;
+    static constexpr Element& element( M& m, std::size_t )              { return m; }
+    static constexpr const Element& element( const M& m, std::size_t )  { return m; }
+};
+template<typename T, std::size_t K>
+struct FieldShape<T[K]> {
+    using Element = T;
+    static constexpr std::size_t COUNT = K;
+    static constexpr Element& element( T (&m)[K], std::size_t k )              { return m[k]; }
+    static constexpr const Element& element( const T (&m)[K], std::size_t k )  { return m[k]; }
+};
+template<typename T, std::size_t K>
+struct FieldShape<Array<T, K>> {
+    using Element = T;
+    static constexpr std::size_t COUNT = K;
+    static constexpr Element& element( Array<T, K>& m, std::size_t k )              { return m[k]; }
+    static constexpr const Element& element( const Array<T, K>& m, std::size_t k )  { return m[k]; }
+};
+
+/*
+ * Cursor over a frame of bytes that is split into at most two contiguous regions, EX: a ring buffer.
+ * Values that don't straddle the split are read/written with a single load/store.
+ * No bounds checks, the owner checks the whole frame fits before handing the cursor to a Layout.
+ */
+template<typename Byte>
+class SplitBytes final {
+private:
+    Byte* first;
+    std::size_t firstLength;
+    Byte* second;
+    std::size_t offset;
+public:
+    constexpr SplitBytes( Byte* f, std::size_t fLength, Byte* s, std::size_t o = 0 ) : first(f), firstLength(fLength), second(s), offset(o) {}
+
+    constexpr std::size_t position()                const { return offset; }
+    constexpr void skip( std::size_t count )              { offset += count; }
+
+    template<typename T, Endian E>
+    constexpr T load() {
+        T value{};
+        if( offset + sizeof(T) <= firstLength ) {
+            value = EDF::load<T, E>( first + offset );
+        }
+        else if( offset >= firstLength ) {
+            value = EDF::load<T, E>( second + (offset - firstLength) );
+        }
+        else {
+            std::uint8_t bytes[sizeof(T)] = {};
+            for( std::size_t k = 0; k < sizeof(T); ++k ) {
+                bytes[k] = at( offset + k );
+            }
+            value = EDF::load<T, E>( bytes );
+        }
+        offset += sizeof(T);
+        return value;
+    }
+
+    template<typename T, Endian E>
+    constexpr void store( const T& value ) {
+        static_assert( !std::is_const_v<Byte>, "store() requires writable bytes" );
+        if( offset + sizeof(T) <= firstLength ) {
+            EDF::store<T, E>( first + offset, value );
+        }
+        else if( offset >= firstLength ) {
+            EDF::store<T, E>( second + (offset - firstLength), value );
+        }
+        else {
+            std::uint8_t bytes[sizeof(T)] = {};
+            EDF::store<T, E>( bytes, value );
+            for( std::size_t k = 0; k < sizeof(T); ++k ) {
+                at( offset + k ) = bytes[k];
+            }
+        }
+        offset += sizeof(T);
+    }
+private:
+    constexpr Byte& at( std::size_t index )         const { return (index < firstLength) ? first[index] : second[index - firstLength]; }
+};
+} /* impl */
+
+/* A member stored as E byte order. The member may be an integer, enum, float, double, or a T[K]/EDF::Array<T, K> of those */
+template<auto Member, Endian E = Endian::big>
+struct Field {
+    using Class = typename impl::MemberPointer<decltype(Member)>::Class;
+    using Shape = impl::FieldShape<typename impl::MemberPointer<decltype(Member)>::Type>;
+    static_assert( impl::isSerializable<typename Shape::Element>, "Field must be an arithmetic or enum type, or an array of them. Use Nested for structs" );
+
+    static constexpr std::size_t SIZE = sizeof(typename Shape::Element) * Shape::COUNT;
+
+    template<typename Source>
+    static constexpr void decode( Source& source, Class& object ) {
+        for( std::size_t k = 0; k < Shape::COUNT; ++k ) {
+            Shape::element( object.*Member, k ) = source.template load<typename Shape::Element, E>();
+        }
+    }
+
+    template<typename Sink>
+    static constexpr void encode( Sink& sink, const Class& object ) {
+        for( std::size_t k = 0; k < Shape::COUNT; ++k ) {
+            sink.template store<typename Shape::Element, E>( Shape::element( object.*Member, k ) );
+        }
+    }
+};
+
+/* A member that is itself a struct described by SubLayout. The member may also be a T[K]/EDF::Array<T, K> of that struct */
+template<auto Member, typename SubLayout>
+struct Nested {
+    using Class = typename impl::MemberPointer<decltype(Member)>::Class;
+    using Shape = impl::FieldShape<typename impl::MemberPointer<decltype(Member)>::Type>;
+    static_assert( std::is_same_v<typename Shape::Element, typename SubLayout::Type>, "SubLayout must describe the member's type" );
+
+    static constexpr std::size_t SIZE = SubLayout::SIZE * Shape::COUNT;
+
+    template<typename Source>
+    static constexpr void decode( Source& source, Class& object ) {
+        for( std::size_t k = 0; k < Shape::COUNT; ++k ) {
+            SubLayout::decode( source, Shape::element( object.*Member, k ) );
+        }
+    }
+
+    template<typename Sink>
+    static constexpr void encode( Sink& sink, const Class& object ) {
+        for( std::size_t k = 0; k < Shape::COUNT; ++k ) {
+            SubLayout::encode( sink, Shape::element( object.*Member, k ) );
+        }
+    }
+};
+
+/* Reserved bytes. Skipped when decoding, written as zero when encoding */
+template<std::size_t Bytes>
+struct Padding {
+    static constexpr std::size_t SIZE = Bytes;
+
+    template<typename Source, typename C>
+    static constexpr void decode( Source& source, C& )              { source.skip( Bytes ); }
+
+    template<typename Sink, typename C>
+    static constexpr void encode( Sink& sink, const C& ) {
+        for( std::size_t k = 0; k < Bytes; ++k ) {
+            sink.template store<std::uint8_t, Endian::big>( 0 );
+        }
+    }
+};
+
+template<typename T, typename... Fields>
+struct Layout {
+    using Type = T;
+    static constexpr std::size_t SIZE = (std::size_t(0) + ... + Fields::SIZE);
+
+    template<typename Source>
+    static constexpr void decode( Source& source, T& object )       { (Fields::decode( source, object ), ...); }
+
+    template<typename Sink>
+    static constexpr void encode( Sink& sink, const T& object )     { (Fields::encode( sink, object ), ...); }
+};
+
+} /* EDF */
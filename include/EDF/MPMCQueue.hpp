@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace EDF {
+
+/*
+ * Lock-free bounded multiple producer / multiple consumer circular queue (Vyukov style).
+ * Every slot carries a sequence number that tells producers and consumers whose turn it is,
+ * so any number of threads may push() and pop() at the same time without a mutex.
+ * Unlike Queue, push()/emplace()/pop() can't assume the queue isn't full/empty, since another
+ * thread may get there first. They return false instead of asserting.
+ */
+template<typename T, std::size_t N>
+class MPMCQueue final{
+private:
+    static_assert( N >= 2, "MPMCQueue needs at least 2 slots" );
+    static_assert( std::atomic<std::size_t>::is_always_lock_free, "MPMCQueue requires lock-free std::size_t atomics" );
+    static constexpr std::size_t WRAP = N-1;
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+    // head and tail on their own cache lines so producers and consumers don't false share
+    alignas(CACHE_LINE) std::atomic<std::size_t> head;  // next position to pop
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail;  // next position to push
+    alignas(CACHE_LINE) EDF::Array<Slot, N> buffer;
+private:
+    static constexpr std::size_t slot( std::size_t position );
+    template<typename Store>
+    bool claimPush( Store&& store );
+public:
+    MPMCQueue();
+    ~MPMCQueue() = default;
+
+    MPMCQueue( const MPMCQueue& ) = delete;
+    MPMCQueue& operator=( const MPMCQueue& ) = delete;
+
+    /* Is Questions */
+    // Snapshots, another thread may change the answer before the caller acts on it
+    bool isEmpty()                      const { return length() == 0; }
+    bool isFull()                       const { return length() == N; }
+
+    /* Capacity */
+    std::size_t length()                const;
+    constexpr std::size_t maxLength()   const { return N; }
+
+    /* Operations */
+    // Returns false, without modifying the queue, if it's full
+    bool push( const T& value );
+    bool push( T&& value );
+
+    template<typename... Args>
+    bool emplace( Args&&... args );
+
+    // Returns false, without modifying value, if it's empty
+    bool pop( T& value );
+};
+
+} /* EDF */
+
+#include "EDF/src/MPMCQueue.tpp"
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+#include "EDF/String.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace EDF {
+
+/*
+ * Hashes a key to 32 bits. Map mixes the result again, so it only has to be different for different keys,
+ * not well distributed. Specialize it for other key types.
+ */
+template<typename K, typename = void>
+struct Hash;
+
+template<typename K>
+struct Hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> {
+    constexpr uint32_t operator()( K key ) const {
+        const auto value = static_cast<uint64_t>(key);
+        return static_cast<uint32_t>(value ^ (value >> 32));
+    }
+};
+
+// FNV-1a over the characters, no copy of the key is made
+template<std::size_t S>
+struct Hash<String<S>> {
+    uint32_t operator()( const String<S>& key ) const {
+        uint32_t hash = 2166136261u;
+        for( const char ch : key ) {
+            hash = (hash ^ static_cast<uint8_t>(ch)) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+/*
+ * Fixed capacity hash map with static storage, for up to N entries.
+ * Open addressing with Robin Hood probing: one byte per slot holds how far its entry is from the slot it
+ * hashed to, and an entry never sits further from home than the entries after it. Lookups stop at the first
+ * slot closer to home than the key would be, so a miss costs about as much as a hit. Erase shifts the
+ * following entries back instead of leaving tombstones, so lookups don't slow down as entries come and go.
+ */
+template<typename K, typename V, std::size_t N, typename H = Hash<K>>
+class Map final {
+public:
+    struct Entry {
+        K key;      // must not be modified through an iterator, the entry would be in the wrong slot
+        V value;
+    };
+private:
+    static_assert( N > 0, "Map needs room for at least 1 entry" );
+    // Power of 2 and at most 80% full
+    static constexpr std::size_t SLOTS = std::size_t(1) << bitWidth( N + N / 4 );
+    static constexpr std::size_t MASK = SLOTS - 1;
+    static constexpr unsigned SHIFT = 32 - bitWidth( MASK );
+
+    Array<uint8_t, SLOTS> distances;    // 0 for an empty slot, else 1 + slots away from home
+    std::size_t n;
+    union {
+        char unused;
+        Entry entries[SLOTS];
+    };
+private:
+    // Fibonacci hashing, spreads keys that only differ in their high or low bits
+    static constexpr std::size_t home( const K& key ) { return static_cast<std::size_t>((H{}( key ) * 2654435769u) >> SHIFT); }
+    static constexpr std::size_t next( std::size_t index ) { return (index + 1) & MASK; }
+    static constexpr std::size_t previous( std::size_t index ) { return (index - 1) & MASK; }
+    // True if key is at index, else index and distance are where key would be placed
+    bool probe( const K& key, std::size_t& index, std::size_t& distance ) const;
+    std::size_t locate( const K& key ) const;
+    void moveEntry( std::size_t from, std::size_t to );
+    template<typename... Args>
+    V& place( std::size_t index, std::size_t distance, const K& key, Args&&... args );
+    template<typename Value>
+    V& assign( const K& key, Value&& value );
+
+    template<typename Owner, typename E>
+    class BasicIterator final {
+    private:
+        Owner* map;
+        std::size_t index;
+        constexpr void skipEmpty() { while( (index != SLOTS) && (map->distances[index] == 0) ) { ++index; } }
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = E*;
+        using reference = E&;
+
+        constexpr BasicIterator( Owner* m, std::size_t i ) : map(m), index(i) { skipEmpty(); }
+        constexpr reference operator*()     const { return map->entries[index]; }
+        constexpr pointer operator->()      const { return &map->entries[index]; }
+        constexpr BasicIterator& operator++()     { ++index; skipEmpty(); return *this; }
+        constexpr BasicIterator operator++( int ) { BasicIterator copy = *this; ++*this; return copy; }
+        constexpr friend bool operator==( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index == rhs.index; }
+        constexpr friend bool operator!=( const BasicIterator& lhs, const BasicIterator& rhs ) { return lhs.index != rhs.index; }
+    };
+public:
+    using Iterator = BasicIterator<Map, Entry>;
+    using ConstIterator = BasicIterator<const Map, const Entry>;
+
+    Map() : distances{}, n(0), unused{} {}
+    ~Map()                                                      { clear(); }
+    Map( const Map& ) = delete;
+    Map& operator=( const Map& ) = delete;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                              const { return n == 0; }
+    constexpr bool isFull()                               const { return n == N; }
+    bool contains( const K& key )                         const { return locate( key ) != SLOTS; }
+
+    /* Capacity */
+    constexpr const std::size_t& length()                 const { return n; }
+    constexpr std::size_t maxLength()                     const { return N; }
+
+    /* Element access */
+    // nullptr if key isn't in the map
+    V* find( const K& key )                                     { const std::size_t index = locate( key ); return (index == SLOTS) ? nullptr : &entries[index].value; }
+    const V* find( const K& key )                         const { const std::size_t index = locate( key ); return (index == SLOTS) ? nullptr : &entries[index].value; }
+
+    V& at( const K& key )                                       { V* value = find( key ); EDF_ASSERTD(value != nullptr, "key must be in the map"); return *value; }
+    const V& at( const K& key )                           const { const V* value = find( key ); EDF_ASSERTD(value != nullptr, "key must be in the map"); return *value; }
+
+    /* Operations */
+    // Adds key, or replaces its value if it's already in the map
+    V& insert( const K& key, const V& value )                   { return assign( key, value ); }
+    V& insert( const K& key, V&& value )                        { return assign( key, std::move(value) ); }
+
+    // Constructs the value in place from args... if key isn't in the map yet, else returns the existing value untouched
+    template<typename... Args>
+    V& emplace( const K& key, Args&&... args );
+
+    // Returns false if key isn't in the map
+    bool erase( const K& key );
+
+    void clear();
+
+    /* Iterators */
+    // Entries are visited in slot order, not insertion order
+    Iterator begin()                                            { return Iterator( this, 0 ); }
+    ConstIterator begin()                                 const { return ConstIterator( this, 0 ); }
+    ConstIterator cbegin()                                const { return ConstIterator( this, 0 ); }
+
+    Iterator end()                                              { return Iterator( this, SLOTS ); }
+    ConstIterator end()                                   const { return ConstIterator( this, SLOTS ); }
+    ConstIterator cend()                                  const { return ConstIterator( this, SLOTS ); }
+};
+
+} /* EDF */
+
+#include "EDF/src/Map.tpp"
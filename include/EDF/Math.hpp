@@ -8,6 +8,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 // NOTE: This needs to be in the global namespace. EX: 0_uz == std::size_t literal
 // tag::literal_size_t[]
@@ -16,6 +18,14 @@ constexpr std::size_t operator ""_uz( unsigned long long x ) { return x; }
 
 namespace EDF {
 
+namespace impl {
+// Smallest unsigned type that can hold every value in [0, Count]
+template<std::size_t Count>
+using IndexFor = std::conditional_t<(Count <= UINT8_MAX), std::uint8_t,
+                 std::conditional_t<(Count <= UINT16_MAX), std::uint16_t,
+                 std::conditional_t<(Count <= UINT32_MAX), std::uint32_t, std::size_t>>>;
+} /* impl */
+
 template<typename T, std::size_t N>
 constexpr std::size_t nElements( const T (&)[N] ) { return N; }
 
@@ -23,6 +33,40 @@ constexpr std::size_t nElements( const T (&)[N] ) { return N; }
 constexpr bool isPow2( std::size_t v ) { return (v != 0) && !(v&(v-1)); }
 // end::is_pow_2[]
 
+// Number of bits needed to represent v, 0 for 0. EX: bitWidth( 5u ) == 3
+template<typename T>
+constexpr unsigned bitWidth( T v ) {
+    static_assert( std::is_unsigned_v<T> && sizeof(T) <= sizeof(unsigned long long), "bitWidth() requires an unsigned integer" );
+    if( v == 0 ) {
+        return 0;
+    }
+    return static_cast<unsigned>((8 * sizeof(unsigned long long)) - __builtin_clzll( v ));
+}
+
+// Index of the lowest set bit. v must not be 0. EX: countTrailingZeros( 8u ) == 3
+template<typename T>
+constexpr unsigned countTrailingZeros( T v ) {
+    static_assert( std::is_unsigned_v<T> && sizeof(T) <= sizeof(unsigned long long), "countTrailingZeros() requires an unsigned integer" );
+    return static_cast<unsigned>(__builtin_ctzll( v ));
+}
+
+// Number of set bits. EX: countSetBits( 0xF0u ) == 4
+// Without a popcount instruction __builtin_popcountll() is a call into a lookup table, so count in parallel
+// within the register instead: 2 bit sums, then 4, then 8, then add up the bytes with one multiply.
+template<typename T>
+constexpr unsigned countSetBits( T v ) {
+    static_assert( std::is_unsigned_v<T> && sizeof(T) <= sizeof(unsigned long long), "countSetBits() requires an unsigned integer" );
+#if defined(__POPCNT__)
+    return static_cast<unsigned>(__builtin_popcountll( v ));
+#else
+    uint64_t x = v;
+    x = x - ((x >> 1) & 0x5555555555555555u);
+    x = (x & 0x3333333333333333u) + ((x >> 2) & 0x3333333333333333u);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Fu;
+    return static_cast<unsigned>((x * 0x0101010101010101u) >> 56);
+#endif
+}
+
 template<typename T>
 constexpr const T& min( const T& lhs, const T& rhs ) {
     return (lhs < rhs) ? lhs : rhs;
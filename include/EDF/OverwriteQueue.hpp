@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+
+#include <cstdint>
+
+namespace EDF {
+
+/*
+ * Circular queue that never fills up. Pushing into a full queue overwrites the oldest element,
+ * so the queue always holds the newest N elements. EX: a window of the latest ADC samples.
+ */
+template<typename T, std::size_t N>
+class OverwriteQueue final{
+private:
+    static constexpr std::size_t WRAP = N-1;
+    std::size_t head;
+    std::size_t n;
+    std::size_t nOverwritten;
+    EDF::Array<T, N> buffer;
+private:
+    static constexpr std::size_t wrap( std::size_t index );
+    constexpr std::size_t nextSlot();
+public:
+    constexpr OverwriteQueue() : head(0), n(0), nOverwritten(0), buffer{} {}
+    template<typename... I>
+    constexpr OverwriteQueue( I... iList ) : head(0), n(sizeof...(I)), nOverwritten(0), buffer{iList...} {}
+    ~OverwriteQueue() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                        const { return n == 0; }
+    constexpr bool isFull()                         const { return n == N; }
+
+    /* Capacity */
+    constexpr const std::size_t& length()           const { return n; }
+    constexpr std::size_t maxLength()               const { return N; }
+    constexpr const std::size_t& overwritten()      const { return nOverwritten; }
+
+    /* Element access. at() counts from the oldest element, latest() counts from the newest element */
+    constexpr T& at( std::size_t index )                  { EDF_ASSERTD(index < n, "index needs to be within bounds of valid entries"); return buffer[wrap( head + index )]; }
+    constexpr const T& at( std::size_t index )      const { EDF_ASSERTD(index < n, "index needs to be within bounds of valid entries"); return buffer[wrap( head + index )]; }
+
+    constexpr T& latest( std::size_t k = 0 )              { EDF_ASSERTD(k < n, "k needs to be within bounds of valid entries"); return buffer[wrap( head + n - 1 - k )]; }
+    constexpr const T& latest( std::size_t k = 0 )  const { EDF_ASSERTD(k < n, "k needs to be within bounds of valid entries"); return buffer[wrap( head + n - 1 - k )]; }
+
+    /* Operations */
+    constexpr T& peek()                                   { return at( 0 ); }
+    constexpr const T& peek()                       const { return at( 0 ); }
+
+    constexpr void push( const T& value )                 { buffer[nextSlot()] = value; }
+    constexpr void push( T&& value )                      { buffer[nextSlot()] = std::move(value); }
+
+    template<typename... Args>
+    constexpr T& emplace( Args&&... args );
+
+    constexpr T pop();
+
+    constexpr void clear()                                { head = 0; n = 0; nOverwritten = 0; }
+};
+
+} /* EDF */
+
+#include "EDF/src/OverwriteQueue.tpp"
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EDF {
+
+namespace impl {
+/*
+ * Lock-free lists of the slot indexes 0 to N-1, shared by AtomicPool and AtomicStack. Every index is on at most
+ * one list at a time, so the lists share one array of links. Each Head is a Treiber stack whose word carries
+ * a counter next to the index, so an index that is taken and given back between another thread reading the
+ * head and swapping it (ABA) makes that swap fail. take() acquires what the matching give() released.
+ * Needs compare and swap on Word, EX: Cortex-M3 and up, not Cortex-M0.
+ */
+template<std::size_t N>
+class AtomicIndexLists final {
+public:
+    using Index = IndexFor<N>;
+    static constexpr Index NONE = N;
+private:
+    using Word = std::conditional_t<(N < UINT16_MAX), std::uint32_t, std::uint64_t>;
+    static constexpr unsigned TAG_SHIFT = 4 * sizeof(Word);
+    static constexpr Word INDEX_MASK = (Word(1) << TAG_SHIFT) - 1;
+    static_assert( N < (std::size_t(1) << TAG_SHIFT), "N must fit next to the ABA tag" );
+
+    static constexpr Word link( Word head, Index index ) { return (((head >> TAG_SHIFT) + 1) << TAG_SHIFT) | index; }
+public:
+    class Head final {
+    private:
+        std::atomic<Word> word;     // (tag << TAG_SHIFT) | index of the first element, NONE when empty
+        friend class AtomicIndexLists;
+    public:
+        constexpr Head() : word(NONE) {}
+    };
+private:
+    // Kept outside the slots so reading a stale link never races with the owner's writes. A link is only
+    // read after give() wrote it, so like the slots they're left uninitialized instead of zeroing N of them
+    union {
+        char unused;
+        std::atomic<Index> next[N];
+    };
+    Head freeHead;
+    std::atomic<Index> unusedSlot;      // indexes >= this one have never been used
+public:
+    constexpr AtomicIndexLists() : unused(0), freeHead{}, unusedSlot(0) {}
+
+    // Removes the first index from head, NONE if it's empty
+    Index take( Head& head );
+    // Adds index to the front of head
+    void give( Head& head, Index index );
+
+    // An index that isn't on any list, from the free list first, else one that has never been used. NONE if all N are in use
+    Index allocate();
+    void deallocate( Index index )                            { give( freeHead, index ); }
+
+    // Walks a list, only once no other thread is using it. EX: destroying the elements left in a destructor
+    Index first( const Head& head )                     const { return static_cast<Index>(head.word.load( std::memory_order_acquire ) & INDEX_MASK); }
+    Index following( Index index )                      const { return next[index].load( std::memory_order_relaxed ); }
+};
+} /* impl */
+
+/*
+ * Fixed block allocator for up to N objects of type T, with static storage.
+ * Free slots are linked through their own storage, allocate() and deallocate() are O(1) with no search.
+ * Slots that have never been used aren't linked until they're needed, and the storage is left uninitialized
+ * like Vector's, so construction is O(1) and doesn't touch them.
+ * Not thread safe, use AtomicPool when allocating from more than one thread or from an ISR.
+ */
+template<typename T, std::size_t N>
+class Pool final {
+private:
+    using Index = impl::IndexFor<N>;
+    static constexpr Index NONE = N;
+
+    union Slot {
+        Index next;                                 // next free slot, while this one is free
+        alignas(T) unsigned char bytes[sizeof(T)];  // storage for a T, while allocated
+    };
+
+    union {
+        char unused;
+        Slot slots[N];
+    };
+    Index freeSlot;
+    Index unusedSlot;   // slots >= this one have never been used
+    Index n;
+    Index highWater;
+private:
+    std::size_t indexOf( const T* pointer ) const;
+public:
+    constexpr Pool() : unused(0), freeSlot(NONE), unusedSlot(0), n(0), highWater(0) {}
+    ~Pool() = default;
+    Pool( const Pool& ) = delete;
+    Pool& operator=( const Pool& ) = delete;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                            const { return n == 0; }
+    constexpr bool isFull()                             const { return n == N; }
+    bool owns( const T* pointer )                       const;
+
+    /* Capacity */
+    constexpr std::size_t length()                      const { return n; }
+    constexpr std::size_t maxLength()                   const { return N; }
+    // Most slots ever allocated at the same time, to size N from a test run
+    constexpr std::size_t highWaterMark()               const { return highWater; }
+    constexpr void resetHighWaterMark()                       { highWater = n; }
+
+    /* Operations */
+    // Uninitialized storage for one T, or nullptr if every slot is allocated
+    T* allocate();
+    void deallocate( T* pointer );
+
+    // allocate() and construct a T from args, or nullptr if every slot is allocated
+    template<typename... Args>
+    T* construct( Args&&... args );
+    void destroy( T* pointer );
+};
+
+/*
+ * Lock-free version of Pool, allocate() and deallocate() may be called from any thread or ISR.
+ * Free slots are kept on an impl::AtomicIndexLists free list, which has the same hardware requirements.
+ */
+template<typename T, std::size_t N>
+class AtomicPool final {
+private:
+    using Lists = impl::AtomicIndexLists<N>;
+    using Index = typename Lists::Index;
+
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    union {
+        char unused;
+        Slot slots[N];
+    };
+    Lists lists;
+    std::atomic<std::size_t> n;
+    std::atomic<std::size_t> highWater;
+private:
+    std::size_t indexOf( const T* pointer ) const;
+public:
+    constexpr AtomicPool() : unused(0), lists{}, n(0), highWater(0) {}
+    ~AtomicPool() = default;
+    AtomicPool( const AtomicPool& ) = delete;
+    AtomicPool& operator=( const AtomicPool& ) = delete;
+
+    /* Is Questions */
+    bool isEmpty()                                      const { return n.load( std::memory_order_relaxed ) == 0; }
+    bool isFull()                                       const { return n.load( std::memory_order_relaxed ) == N; }
+    bool owns( const T* pointer )                       const;
+
+    /* Capacity */
+    // Only a snapshot while other threads are allocating
+    std::size_t length()                                const { return n.load( std::memory_order_relaxed ); }
+    constexpr std::size_t maxLength()                   const { return N; }
+    std::size_t highWaterMark()                         const { return highWater.load( std::memory_order_relaxed ); }
+    void resetHighWaterMark()                                 { highWater.store( length(), std::memory_order_relaxed ); }
+
+    /* Operations */
+    T* allocate();
+    void deallocate( T* pointer );
+
+    template<typename... Args>
+    T* construct( Args&&... args );
+    void destroy( T* pointer );
+};
+
+} /* EDF */
+
+#include "EDF/src/Pool.tpp"
@@ -8,18 +8,38 @@
 #pragma once
 
 #include "EDF/Array.hpp"
+#include "EDF/Endian.hpp"
+#include "EDF/Math.hpp"
+#include "EDF/Span.hpp"
 
 #include <cstdint>
 
 namespace EDF {
 
-template<typename T, std::size_t N>
+// tag::queue_mode[]
+enum class QueueMode {
+    wrapped,        // head and tail wrap at N. Holds at most N-1 elements
+    freeRunning,    // head and tail count up forever, masked on access. Holds N elements, N must be a power of 2
+};
+// end::queue_mode[]
+
+template<typename T, std::size_t N, QueueMode M = QueueMode::wrapped>
 class Queue final{
 private:
+    static_assert( (M != QueueMode::freeRunning) || isPow2( N ), "QueueMode::freeRunning requires N to be a power of 2" );
     static constexpr std::size_t WRAP = N-1;
     std::size_t head;
     std::size_t tail;
     EDF::Array<T, N> buffer;
+private:
+    static constexpr std::size_t slot( std::size_t index );
+    static constexpr std::size_t advance( std::size_t index, std::size_t count );
+
+    template<typename U, Endian E>
+    constexpr U popWord();
+
+    template<typename U, Endian E>
+    constexpr void pushWord( U value );
 public:
     constexpr Queue() : head(0), tail(0), buffer{} {}
     template<typename... I>
@@ -32,11 +52,11 @@ public:
 
     /* Capacity */
     constexpr std::size_t length()      const;
-    constexpr std::size_t maxLength()   const { return WRAP; }
+    constexpr std::size_t maxLength()   const { return (M == QueueMode::freeRunning) ? N : WRAP; }
 
     /* Operations */
-    constexpr T& peek()                       { return buffer[head]; }
-    constexpr const T& peek()           const { return buffer[head]; }
+    constexpr T& peek()                       { return buffer[slot( head )]; }
+    constexpr const T& peek()           const { return buffer[slot( head )]; }
 
     constexpr void push( const T& value );
     constexpr void push( const T&& value );
@@ -48,6 +68,21 @@ public:
 
     constexpr void clear()                    { while( !isEmpty() ) { pop(); } }
 
+    /* Bulk operations */
+    constexpr void push( const T* values, std::size_t count );
+    constexpr void pop( T* values, std::size_t count );
+
+    /* In place access. Up to two contiguous regions, the second one is empty unless the region wraps */
+    using Spans = Array<Span<T>, 2>;
+    using ConstSpans = Array<Span<const T>, 2>;
+
+    constexpr Spans readableSpans();
+    constexpr ConstSpans readableSpans()      const;
+    constexpr Spans writableSpans();
+
+    constexpr void commitPush( std::size_t count );
+    constexpr void commitPop( std::size_t count );
+
     /* uint8_t specialized member functions */
     constexpr std::uint8_t pop8be();
     constexpr std::uint16_t pop16be();
@@ -58,8 +93,22 @@ public:
     constexpr std::uint16_t pop16le();
     constexpr std::uint32_t pop32le();
     constexpr std::uint64_t pop64le();
+
+    constexpr void push8be( std::uint8_t value );
+    constexpr void push16be( std::uint16_t value );
+    constexpr void push32be( std::uint32_t value );
+    constexpr void push64be( std::uint64_t value );
+
+    constexpr void push8le( std::uint8_t value );
+    constexpr void push16le( std::uint16_t value );
+    constexpr void push32le( std::uint32_t value );
+    constexpr void push64le( std::uint64_t value );
 };
 
+// tag::declare_queue_free_running[]
+template<typename T, std::size_t N>
+using QueueFreeRunning = Queue<T, N, QueueMode::freeRunning>;
+// end::declare_queue_free_running[]
 
 } /* EDF */
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Queue.hpp"
+#include "EDF/Layout.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace EDF {
+
+/*
+ * Decodes fixed size binary frames straight out of a Queue<std::uint8_t, N, M> without copying them out first.
+ * Bytes are only removed from the queue by commit(), so a partially received frame can be left in place.
+ */
+template<std::size_t N, QueueMode M = QueueMode::wrapped>
+class QueueReader final {
+private:
+    Queue<std::uint8_t, N, M>& queue;
+    typename Queue<std::uint8_t, N, M>::ConstSpans spans;
+    std::size_t offset;
+private:
+    constexpr impl::SplitBytes<const std::uint8_t> cursor() const;
+public:
+    explicit constexpr QueueReader( Queue<std::uint8_t, N, M>& source ) : queue(source), spans(std::as_const(source).readableSpans()), offset(0) {}
+    ~QueueReader() = default;
+
+    /* Capacity */
+    constexpr std::size_t available()                   const { return spans[0].length() + spans[1].length() - offset; }
+    constexpr std::size_t consumed()                    const { return offset; }
+
+    /* Operations */
+    template<typename L>
+    constexpr bool read( typename L::Type& value );
+
+    template<typename T, Endian E = Endian::big>
+    constexpr T read();
+
+    constexpr void skip( std::size_t count );
+
+    constexpr void commit();
+    constexpr void rewind()                                   { offset = 0; }
+    constexpr void refresh()                                  { spans = std::as_const(queue).readableSpans(); }
+};
+
+} /* EDF */
+
+#include "EDF/src/QueueReader.tpp"
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Queue.hpp"
+#include "EDF/Layout.hpp"
+
+#include <cstdint>
+
+namespace EDF {
+
+/*
+ * Encodes fixed size binary frames straight into the free space of a Queue<std::uint8_t, N, M>.
+ * Bytes are only added to the queue by commit(), so a consumer never sees a partially written frame.
+ */
+template<std::size_t N, QueueMode M = QueueMode::wrapped>
+class QueueWriter final {
+private:
+    Queue<std::uint8_t, N, M>& queue;
+    typename Queue<std::uint8_t, N, M>::Spans spans;
+    std::size_t offset;
+private:
+    constexpr impl::SplitBytes<std::uint8_t> cursor() const;
+public:
+    explicit constexpr QueueWriter( Queue<std::uint8_t, N, M>& destination ) : queue(destination), spans(destination.writableSpans()), offset(0) {}
+    ~QueueWriter() = default;
+
+    /* Capacity */
+    constexpr std::size_t available()                   const { return spans[0].length() + spans[1].length() - offset; }
+    constexpr std::size_t written()                     const { return offset; }
+
+    /* Operations */
+    template<typename L>
+    constexpr bool write( const typename L::Type& value );
+
+    template<typename T, Endian E = Endian::big>
+    constexpr void write( const T& value );
+
+    constexpr void commit();
+    constexpr void rewind()                                   { offset = 0; }
+    constexpr void refresh()                                  { spans = queue.writableSpans(); }
+};
+
+} /* EDF */
+
+#include "EDF/src/QueueWriter.tpp"
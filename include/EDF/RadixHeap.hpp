@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/Math.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EDF {
+
+namespace impl {
+template<typename T>
+struct IdentityKey {
+    constexpr const T& operator()( const T& value ) const { return value; }
+};
+} /* impl */
+
+/*
+ * Min priority queue for monotone unsigned integer keys, EX: tick based timestamps that only ever increase.
+ * Every pushed key must be >= the key last popped. Elements are kept in buckets by the highest bit
+ * their key differs from the last popped key, each element only moves to a lower bucket, so push is
+ * O(1) and pop is amortized O(bits in the key).
+ * KeyOf returns the key of an element, so T may carry a payload along with its key.
+ * Slots are left uninitialized like Vector's until they're used, so construction is O(1) and T doesn't need a default constructor.
+ */
+template<typename T, std::size_t N, typename KeyOf = impl::IdentityKey<T>>
+class RadixHeap final {
+public:
+    using Key = std::decay_t<decltype(std::declval<const KeyOf&>()( std::declval<const T&>() ))>;
+private:
+    static_assert( std::is_unsigned_v<Key> && sizeof(Key) <= sizeof(std::uint64_t), "RadixHeap requires an unsigned integer key" );
+    using Index = impl::IndexFor<N>;
+    static constexpr Index NONE = N;
+    static constexpr std::size_t BUCKETS = (8 * sizeof(Key)) + 1;
+
+    union {
+        char noValues;
+        T values[N];
+    };
+    union {
+        char noLinks;
+        Index next[N];              // next element in the same bucket, or the next free slot
+    };
+    Array<Index, BUCKETS> buckets;  // first element of each bucket
+    std::uint64_t nonEmpty;         // bit b-1 is set when bucket b > 0 holds elements
+    Index freeSlot;
+    Index unusedSlot;               // slots >= this one have never been used
+    std::size_t n;
+    Key last;
+    KeyOf keyOf;
+private:
+    constexpr std::size_t bucketOf( Key key ) const;
+    constexpr void link( Index slot );
+    constexpr Index acquireSlot();
+    constexpr void refill();
+public:
+    constexpr RadixHeap() : noValues(0), noLinks(0), buckets{}, nonEmpty(0), freeSlot(NONE), unusedSlot(0), n(0), last(0), keyOf{} { buckets.fill( NONE ); }
+    constexpr explicit RadixHeap( const KeyOf& k ) : noValues(0), noLinks(0), buckets{}, nonEmpty(0), freeSlot(NONE), unusedSlot(0), n(0), last(0), keyOf(k) { buckets.fill( NONE ); }
+    ~RadixHeap()                                  { clear(); }
+
+    /* Is Questions */
+    constexpr bool isEmpty()                const { return n == 0; }
+    constexpr bool isFull()                 const { return n == N; }
+
+    /* Capacity */
+    constexpr const std::size_t& length()   const { return n; }
+    constexpr std::size_t maxLength()       const { return N; }
+
+    /* Operations */
+    // O(1) when the smallest key equals the last key popped, otherwise scans the lowest non-empty bucket
+    constexpr T& peek()                           { return const_cast<T&>(std::as_const(*this).peek()); }
+    constexpr const T& peek()               const;
+
+    constexpr void push( const T& value );
+    constexpr void push( T&& value );
+
+    template<typename... Args>
+    constexpr T& emplace( Args&&... args );
+
+    constexpr T pop();
+
+    // The key last popped, pushed keys must be >= this
+    constexpr Key lastKey()                 const { return last; }
+
+    constexpr void clear();
+};
+
+} /* EDF */
+
+#include "EDF/src/RadixHeap.tpp"
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace EDF {
+
+/*
+ * Lock-free single producer / single consumer circular queue.
+ * One context (EX: an ISR) may call push()/emplace() while another context (EX: the main loop)
+ * calls peek()/pop()/clear() without disabling interrupts or taking a lock.
+ */
+template<typename T, std::size_t N>
+class SPSCQueue final{
+private:
+    static_assert( std::atomic<std::size_t>::is_always_lock_free, "SPSCQueue requires lock-free std::size_t atomics" );
+    static constexpr std::size_t WRAP = N-1;
+    std::atomic<std::size_t> head;  // only written by the consumer
+    std::atomic<std::size_t> tail;  // only written by the producer
+    EDF::Array<T, N> buffer;
+private:
+    static constexpr std::size_t next( std::size_t index );
+public:
+    constexpr SPSCQueue() : head(0), tail(0), buffer{} {}
+    template<typename... I>
+    constexpr SPSCQueue( I... iList ) : head(0), tail(sizeof...(I)), buffer{iList...} {}
+    ~SPSCQueue() = default;
+
+    SPSCQueue( const SPSCQueue& ) = delete;
+    SPSCQueue& operator=( const SPSCQueue& ) = delete;
+
+    /* Is Questions */
+    bool isEmpty()                      const { return head.load( std::memory_order_acquire ) == tail.load( std::memory_order_acquire ); }
+    bool isFull()                       const { return next( tail.load( std::memory_order_acquire ) ) == head.load( std::memory_order_acquire ); }
+
+    /* Capacity */
+    std::size_t length()                const;
+    constexpr std::size_t maxLength()   const { return WRAP; }
+
+    /* Producer operations */
+    void push( const T& value );
+    void push( T&& value );
+
+    // Returns nothing, the element belongs to the consumer as soon as it is published
+    template<typename... Args>
+    void emplace( Args&&... args );
+
+    /* Consumer operations */
+    T& peek()                                 { return buffer[head.load( std::memory_order_relaxed )]; }
+    const T& peek()                     const { return buffer[head.load( std::memory_order_relaxed )]; }
+
+    T pop();
+
+    void clear()                              { head.store( tail.load( std::memory_order_acquire ), std::memory_order_release ); }
+};
+
+} /* EDF */
+
+#include "EDF/src/SPSCQueue.tpp"
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Array.hpp"
+#include "EDF/IndexedHeap.hpp"
+#include "EDF/Queue.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace EDF {
+
+/*
+ * Cooperative scheduler for up to N one shot or periodic jobs, with static storage.
+ * Pending deadlines are kept in a heap, so finding the next one is O(1) and scheduling/cancelling is O(log N).
+ * Free job slots are linked like Pool's, so scheduling doesn't search for one.
+ * Due jobs are moved to a ready queue and dispatched in deadline order from runUntilIdle().
+ *
+ * Clock provides a static now() returning an unsigned tick count, EX: a SysTick counter.
+ * Ticks may wrap, as long as no delay or period is longer than half the range of the tick type.
+ *
+ *   struct SysTickClock { static uint32_t now() { return ticks; } };
+ *   EDF::Scheduler<16, SysTickClock> scheduler;
+ */
+template<std::size_t N, typename Clock>
+class Scheduler final {
+public:
+    using Tick = std::decay_t<decltype(Clock::now())>;
+    using Callback = void (*)( void* context );
+
+    struct JobId {
+        std::size_t slot;
+        std::size_t generation;
+        constexpr bool isValid()                        const { return slot < N; }
+        constexpr friend bool operator==( const JobId& lhs, const JobId& rhs ) { return (lhs.slot == rhs.slot) && (lhs.generation == rhs.generation); }
+        constexpr friend bool operator!=( const JobId& lhs, const JobId& rhs ) { return !(lhs == rhs); }
+    };
+    static constexpr JobId INVALID_JOB = { N, 0 };
+private:
+    static_assert( std::is_unsigned_v<Tick>, "Clock::now() must return an unsigned tick count" );
+    using SignedTick = std::make_signed_t<Tick>;
+
+    enum class State : std::uint8_t { free, pending, ready };   // free is 0, so value initialized jobs start free
+    struct Job {
+        Callback callback;
+        void* context;
+        Tick due;
+        Tick period;
+        std::size_t handle;             // position in deadlines while pending, the next free slot while free
+        std::size_t generation;
+        State state;
+    };
+    // Ordered by the wrapping difference between deadlines, not their raw values
+    struct Deadline {
+        Tick due;
+        std::size_t slot;
+        constexpr bool operator<( const Deadline& rhs )    const { return difference( due, rhs.due ) < 0; }
+    };
+    struct Ready {
+        std::size_t slot;
+        std::size_t generation;
+    };
+
+    Array<Job, N> jobs;
+    IndexedHeapMin<Deadline, N> deadlines;
+    Queue<Ready, N + 1> ready;
+    std::size_t freeSlot;       // N when no released slot is waiting to be reused
+    std::size_t unusedSlot;     // slots >= this one have never been used
+    std::size_t nJobs;          // pending or ready, not counting ready queue entries made stale by cancel()
+    Tick dispatchNow;           // the now passed to runUntilIdle(), while it's dispatching
+    bool dispatching;
+    Tick lateTolerance;
+    std::size_t nLate;
+    Tick worstLateness;
+private:
+    static constexpr SignedTick difference( Tick lhs, Tick rhs ) { return static_cast<SignedTick>(static_cast<Tick>(lhs - rhs)); }
+    constexpr bool owns( JobId id )                         const { return id.isValid() && (jobs[id.slot].generation == id.generation) && (jobs[id.slot].state != State::free); }
+    constexpr void release( std::size_t slot );
+    constexpr void dispatch( std::size_t slot, Tick now );
+public:
+    // Dispatches more than lateTolerance ticks after their deadline are counted as late
+    constexpr explicit Scheduler( Tick tolerance = 0 ) : jobs{}, deadlines{}, ready{}, freeSlot(N), unusedSlot(0), nJobs(0), dispatchNow(0), dispatching(false), lateTolerance(tolerance), nLate(0), worstLateness(0) {}
+    ~Scheduler() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                const { return length() == 0; }
+    constexpr bool isFull()                                 const { return length() == N; }
+    constexpr bool isScheduled( JobId id )                  const { return owns( id ); }
+
+    /* Capacity */
+    constexpr std::size_t length()                          const { return nJobs; }
+    constexpr std::size_t maxLength()                       const { return N; }
+
+    /* Operations */
+    // Runs callback( context ) delay ticks from now, then every period ticks if period isn't 0. Returns INVALID_JOB if full.
+    // Inside a callback, delay counts from the now passed to runUntilIdle(), not Clock::now()
+    JobId schedule( Callback callback, void* context, Tick delay, Tick period = 0 );
+    // Returns false if the job already finished, or was already cancelled
+    constexpr bool cancel( JobId id );
+
+    // Dispatches every job due at now, including jobs that become due while dispatching. Returns how many ran
+    std::size_t runUntilIdle( Tick now );
+    std::size_t runUntilIdle()                                    { return runUntilIdle( Clock::now() ); }
+
+    // Ticks until the next deadline, 0 if one is already due. Sleep this long instead of polling
+    constexpr Tick ticksUntilNext( Tick now )               const;
+    constexpr bool hasPending()                             const { return !deadlines.isEmpty(); }
+
+    /* Statistics */
+    constexpr std::size_t lateDispatches()                  const { return nLate; }
+    constexpr Tick maxLateness()                            const { return worstLateness; }
+    constexpr void resetStatistics()                              { nLate = 0; worstLateness = 0; }
+};
+
+} /* EDF */
+
+#include "EDF/src/Scheduler.tpp"
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Vector.hpp"
+
+#include <memory>
+
+namespace EDF {
+
+/*
+ * Vector that keeps up to N elements inline, and moves them to a buffer from Alloc once it needs more room.
+ * The capacity doubles each time it grows, so n pushBack()s cost O(n) in total. Alloc only provides the memory,
+ * elements are constructed in place like Vector.
+ */
+template<typename T, std::size_t N, typename Alloc = std::allocator<T>>
+class SmallVector final {
+private:
+    static_assert( N != 0, "SmallVector needs room for at least 1 inline element" );
+    static_assert( std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>, "Alloc must allocate T" );
+    using Traits = std::allocator_traits<Alloc>;
+
+    T* elements;            // inlineElements, or the buffer from allocator once spilled
+    std::size_t n;
+    std::size_t limit;      // number of elements that fit in elements
+    Alloc allocator;
+    union {
+        char unused;
+        T inlineElements[N];
+    };
+private:
+    constexpr void reallocate( std::size_t newLimit );
+    constexpr void growFor( std::size_t count )                                           { if( count > limit ) { reallocate( EDF::max( 2 * limit, count ) ); } }
+    constexpr void release();
+public:
+    constexpr SmallVector() : elements(inlineElements), n(0), limit(N), allocator{}, unused{} {}
+    constexpr explicit SmallVector( const Alloc& a ) : elements(inlineElements), n(0), limit(N), allocator(a), unused{} {}
+    template<typename... I>
+    constexpr SmallVector( I... iList );
+    constexpr SmallVector( const SmallVector& other );
+    constexpr SmallVector( SmallVector&& other );
+    constexpr SmallVector& operator=( const SmallVector& other );
+    constexpr SmallVector& operator=( SmallVector&& other );
+    ~SmallVector()                                                                        { release(); }
+
+    using Iterator = typename Vector<T,N>::Iterator;
+    using ConstIterator = typename Vector<T,N>::ConstIterator;
+    using ReverseIterator = typename Vector<T,N>::ReverseIterator;
+    using ConstReverseIterator = typename Vector<T,N>::ConstReverseIterator;
+
+     /* Current state */
+    constexpr bool isEmpty()                                                        const { return n == 0; }
+    // Only true when the allocator can't provide any more elements
+    constexpr bool isFull()                                                         const { return n == maxLength(); }
+    constexpr bool isInline()                                                       const { return elements == inlineElements; }
+
+     /* Capacity */
+    constexpr const std::size_t& length()                                           const { return n; }
+    constexpr std::size_t maxLength()                                               const { return Traits::max_size( allocator ); }
+    constexpr std::size_t capacity()                                                const { return limit; }
+    constexpr void reserve( std::size_t count )                                           { if( count > limit ) { reallocate( count ); } }
+
+    /* Element access */
+    constexpr T& at( std::size_t index )                                                  { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return elements[index]; }
+    constexpr const T& at( std::size_t index )                                      const { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return elements[index]; }
+
+    constexpr T& operator[]( std::size_t index )                                          { return elements[index]; }
+    constexpr const T& operator[]( std::size_t index )                              const { return elements[index]; }
+
+    constexpr T& front()                                                                  { return at( 0 ); }
+    constexpr const T& front()                                                      const { return at( 0 ); }
+
+    constexpr T& back()                                                                   { return at( n - 1 ); }
+    constexpr const T& back()                                                       const { return at( n - 1 ); }
+
+    constexpr T* data()                                                                   { return elements; }
+    constexpr const T* data()                                                       const { return elements; }
+
+    /* Operations */
+    // Keeps the allocated buffer, if there is one
+    constexpr void clear()                                                                { std::destroy( begin(), end() ); n = 0; }
+
+    constexpr void insert( std::size_t index, const T& value )                            { insert( ConstIterator(data() + index), value ); }
+    constexpr void insert( std::size_t index, T&& value )                                 { insert( ConstIterator(data() + index), std::move(value) ); }
+    constexpr void insert( std::size_t index, std::size_t count, const T& value )         { insert( ConstIterator(data() + index), count, value ); }
+    constexpr void insert( std::size_t index, std::initializer_list<T> iList )            { insert( ConstIterator(data() + index), iList ); }
+    constexpr Iterator insert( ConstIterator pos, const T& value )                        { return insert( pos, 1, value ); }
+    constexpr Iterator insert( ConstIterator pos, T&& value )                             { return emplace( pos, std::move(value) ); }
+    constexpr Iterator insert( ConstIterator pos, std::size_t count, const T& value );
+    constexpr Iterator insert( ConstIterator pos, std::initializer_list<T> iList );
+
+    template<typename... Args>
+    constexpr void emplace( std::size_t index, Args&&... args )                           { emplace( ConstIterator(data() + index), std::forward<Args>(args)...); }
+    template<typename... Args>
+    constexpr Iterator emplace( ConstIterator pos, Args&&... args );
+
+    constexpr void erase( std::size_t index )                                             { erase( ConstIterator(data() + index) ); }
+    constexpr void erase( std::size_t first, std::size_t last )                           { erase( ConstIterator(data() + first), ConstIterator(data() + last) ); }
+    constexpr Iterator erase( ConstIterator pos )                                         { return erase( pos, pos + 1 ); }
+    constexpr Iterator erase( ConstIterator first, ConstIterator last );
+
+    constexpr void pushBack( const T& value )                                             { emplaceBack( value ); }
+    constexpr void pushBack( T&& value )                                                  { emplaceBack( std::move(value) ); }
+
+    template<typename... Args>
+    constexpr T& emplaceBack( Args&&... args )                                            { return *emplace( end(), std::forward<Args>(args)... ); }
+
+    constexpr T popBack();
+
+    /* Bulk Operations */
+    template<typename InputIt>
+    constexpr void assign( InputIt first, InputIt last )                                  { clear(); append( first, last ); }
+    template<typename InputIt>
+    constexpr void append( InputIt first, InputIt last );
+
+    constexpr void resize( std::size_t count );
+    constexpr void resize( std::size_t count, const T& value );
+
+    // The unused slots of the current buffer. Call reserve() first to make room for more
+    constexpr Span<T> spareCapacity()                                                     { return Span<T>( data() + n, limit - n ); }
+    constexpr void commit( std::size_t count );
+
+    /* Iterators */
+    constexpr Iterator begin()                                                            { return Iterator( data() ); }
+    constexpr ConstIterator begin()                                                 const { return ConstIterator( data() ); }
+    constexpr ConstIterator cbegin()                                                const { return ConstIterator( data() ); }
+
+    constexpr Iterator end()                                                              { return Iterator( data() + n ); }
+    constexpr ConstIterator end()                                                   const { return ConstIterator( data() + n ); }
+    constexpr ConstIterator cend()                                                  const { return ConstIterator( data() + n ); }
+
+    constexpr ReverseIterator rbegin()                                                    { return ReverseIterator( end() ); }
+    constexpr ConstReverseIterator rbegin()                                         const { return ConstReverseIterator( end() ); }
+    constexpr ConstReverseIterator crbegin()                                        const { return ConstReverseIterator( end() ); }
+
+    constexpr ReverseIterator rend()                                                      { return ReverseIterator( begin() ); }
+    constexpr ConstReverseIterator rend()                                           const { return ConstReverseIterator( begin() ); }
+    constexpr ConstReverseIterator crend()                                          const { return ConstReverseIterator( begin() ); }
+};
+
+/* Non-member functions */
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr bool operator==( const SmallVector<T, N, Alloc>& lhs, const SmallVector<T, N, Alloc>& rhs ) {
+    return std::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
+}
+
+} /* EDF */
+
+#include "EDF/src/SmallVector.tpp"
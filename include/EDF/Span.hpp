@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Assert.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+namespace EDF {
+
+/* Non-owning view of a contiguous region of elements. EX: part of a container's buffer handed to DMA */
+template<typename T>
+class Span final {
+private:
+    T* ptr;
+    std::size_t n;
+public:
+    constexpr Span() : ptr(nullptr), n(0) {}
+    constexpr Span( T* data, std::size_t length ) : ptr(data), n(length) {}
+    template<std::size_t N>
+    constexpr Span( T (&array)[N] ) : ptr(array), n(N) {}
+    ~Span() = default;
+
+    /* Is Questions */
+    constexpr bool isEmpty()                                  const { return n == 0; }
+
+    /* Capacity */
+    constexpr std::size_t length()                            const { return n; }
+    constexpr std::size_t lengthBytes()                       const { return n * sizeof(T); }
+
+    /* Element access */
+    constexpr T& at( std::size_t index )                      const { EDF_ASSERTD(index < n, "index needs to be within bounds of span"); return ptr[index]; }
+    constexpr T& operator[]( std::size_t index )              const { return ptr[index]; }
+
+    constexpr T& front()                                      const { return at( 0 ); }
+    constexpr T& back()                                       const { return at( n - 1 ); }
+
+    constexpr T* data()                                       const { return ptr; }
+
+    /* Operations */
+    constexpr Span first( std::size_t count )                 const { EDF_ASSERTD(count <= n, "count needs to be within bounds of span"); return Span( ptr, count ); }
+    constexpr Span last( std::size_t count )                  const { EDF_ASSERTD(count <= n, "count needs to be within bounds of span"); return Span( ptr + (n - count), count ); }
+    constexpr Span subspan( std::size_t offset, std::size_t count ) const { EDF_ASSERTD(offset + count <= n, "subspan needs to be within bounds of span"); return Span( ptr + offset, count ); }
+
+    /* Iterators */
+    using Iterator = T*;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+
+    constexpr Iterator begin()                                const { return Iterator( ptr ); }
+    constexpr Iterator end()                                  const { return Iterator( ptr + n ); }
+
+    constexpr ReverseIterator rbegin()                        const { return ReverseIterator( end() ); }
+    constexpr ReverseIterator rend()                          const { return ReverseIterator( begin() ); }
+};
+
+} /* EDF */
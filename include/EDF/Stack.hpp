@@ -7,8 +7,15 @@
 
 #pragma once
 
+#include "EDF/Array.hpp"
+#include "EDF/Math.hpp"
+#include "EDF/Pool.hpp"
 #include "EDF/Vector.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
 namespace EDF {
 
 template<typename T, std::size_t N>
@@ -34,14 +41,74 @@ public:
     constexpr const T& peek()               const { return buffer.back(); }
 
     constexpr void push( const T& value )         { buffer.pushBack( value ); }
-    constexpr void push( const T&& value )        { buffer.pushBack( value ); }
+    constexpr void push( T&& value )              { buffer.pushBack( std::move(value) ); }
 
     template<typename... Args>
     constexpr T& emplace( Args&&... args )        { return buffer.emplaceBack(std::forward<Args>(args)...); }
 
     constexpr T pop()                             { return buffer.popBack(); }
 
+    // Same as push() for values[0] to values[count - 1], values[count - 1] ends up on top
+    constexpr void pushN( const T* values, std::size_t count )  { buffer.append( values, values + count ); }
+    // Same as pop() count times, values[0] is the old top
+    constexpr void popN( T* values, std::size_t count );
+    // Same as pop() count times, discarding the values
+    constexpr void popN( std::size_t count );
+
     constexpr void clear()                        { buffer.clear(); }
 };
 
-} /* EDF */
\ No newline at end of file
+/*
+ * Lock-free bounded stack, push() and pop() may be called from any thread or ISR at the same time.
+ * Elements live in N fixed slots linked by index. The stack and the free slots are two lists of
+ * impl::AtomicIndexLists, the same ABA tagged lists AtomicPool uses for its free slots.
+ */
+template<typename T, std::size_t N>
+class AtomicStack final {
+private:
+    using Lists = impl::AtomicIndexLists<N>;
+    using Index = typename Lists::Index;
+
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    union {
+        char unused;                    // active member, so the slots are left uninitialized like AtomicPool's
+        Slot slots[N];
+    };
+    Lists lists;                        // the free slots, plus the links for top
+    typename Lists::Head top;
+    std::atomic<std::size_t> n;
+private:
+    T* element( Index index )                           { return reinterpret_cast<T*>(slots[index].bytes); }
+public:
+    constexpr AtomicStack() : unused(0), lists{}, top{}, n(0) {}
+    ~AtomicStack();
+    AtomicStack( const AtomicStack& ) = delete;
+    AtomicStack& operator=( const AtomicStack& ) = delete;
+
+    /* Is Questions */
+    // Snapshots, another thread may change the answer before the caller acts on it
+    bool isEmpty()                                      const { return length() == 0; }
+    bool isFull()                                       const { return length() == N; }
+
+    /* Capacity */
+    std::size_t length()                                const { return n.load( std::memory_order_relaxed ); }
+    constexpr std::size_t maxLength()                   const { return N; }
+
+    /* Operations */
+    // Returns false, without modifying the stack, if it's full
+    bool push( const T& value )                               { return emplace( value ); }
+    bool push( T&& value )                                    { return emplace( std::move(value) ); }
+
+    template<typename... Args>
+    bool emplace( Args&&... args );
+
+    // Returns false, without modifying value, if it's empty
+    bool pop( T& value );
+};
+
+} /* EDF */
+
+#include "EDF/src/Stack.tpp"
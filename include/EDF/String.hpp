@@ -464,6 +464,12 @@ public:
     template<std::size_t S>
     friend constexpr String<EDF::max(S,N)> operator+( const String<S>& lhs, const String& rhs ) { String<EDF::max(N,S)> result(lhs); result.append(rhs); return result; }
 
+    /* Operations: Operator Overload - ==, != */
+    template<std::size_t S>
+    friend constexpr bool operator==( const String& lhs, const String<S>& rhs ) { return lhs.equals( rhs ); }
+    template<std::size_t S>
+    friend constexpr bool operator!=( const String& lhs, const String<S>& rhs ) { return !lhs.equals( rhs ); }
+
     /* Iterators */
     constexpr Iterator begin();
     constexpr ConstIterator begin() const;
@@ -8,21 +8,80 @@
 
 #include "EDF/Array.hpp"
 #include "EDF/Math.hpp"
+#include "EDF/Span.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace EDF {
 
+namespace impl {
+// True if T t = { from }; compiles, the rule brace initializing an array of T follows: an implicit
+// conversion that doesn't narrow. GCC only warns about narrowing a non-constant, so test for it here.
+template<typename T, typename From, typename = void>
+struct IsCopyListInitializable : std::false_type {};
+template<typename T, typename From>
+struct IsCopyListInitializable<T, From, std::void_t<decltype(T{std::declval<From>()})>> : std::is_convertible<From, T> {};
+
+/*
+ * Raw storage for up to N elements, only the first n are alive. The anonymous union leaves the elements
+ * uninitialized, so an empty Vector is O(1) to construct and T doesn't need a default constructor.
+ * The live elements are only destroyed when T needs it, otherwise the destructor stays trivial.
+ */
+template<typename T, std::size_t N, bool = std::is_trivially_destructible_v<T>>
+struct VectorStorage {
+    std::size_t n;
+    union {
+        char unused;
+        T elements[N];
+    };
+    constexpr VectorStorage() : n(0), unused{} {}
+    // Brace initializes the elements, so a list constructed Vector can be a constant expression.
+    // The rest of the N elements are value initialized, so it's only used at compile time
+    template<typename... I>
+    constexpr VectorStorage( std::in_place_t, I&&... iList ) : n(sizeof...(I)), elements{std::forward<I>(iList)...} {}
+};
+
+template<typename T, std::size_t N>
+struct VectorStorage<T, N, false> {
+    std::size_t n;
+    union {
+        char unused;
+        T elements[N];
+    };
+    constexpr VectorStorage() : n(0), unused{} {}
+    ~VectorStorage() { std::destroy_n( elements, n ); }
+};
+
+// Storage for a Vector list constructed from iList. At compile time the elements are already in it,
+// at run time it's empty, and the caller constructs them in place without touching the rest
+template<typename T, std::size_t N, typename... I>
+constexpr VectorStorage<T, N> makeListStorage( I&&... iList );
+
+// Moves count elements from [from, from + count) to [to, to + count), the ranges may overlap
+template<typename T>
+constexpr void shift( T* from, T* to, std::size_t count );
+
+// Moves [position, last) right by count, [position, position + count) is left uninitialized
+template<typename T>
+constexpr void openGap( T* position, T* last, std::size_t count );
+} /* impl */
+
 template<typename T, std::size_t N>
 class Vector final{
 private:
-    std::size_t n;
-    Array<T, N> buffer;
+    impl::VectorStorage<T, N> storage;
 public:
-    constexpr Vector() : n(0), buffer{} {}
+    constexpr Vector() : storage{} {}
     template<typename... I>
-    constexpr Vector( I... iList ) : n(sizeof...(I)), buffer{iList...} {}
+    constexpr Vector( I... iList );
+    constexpr Vector( const Vector& other );
+    constexpr Vector( Vector&& other );
+    constexpr Vector& operator=( const Vector& other );
+    constexpr Vector& operator=( Vector&& other );
     ~Vector() = default;
 
     using Iterator = typename Array<T,N>::Iterator;
@@ -31,34 +90,34 @@ public:
     using ConstReverseIterator = typename Array<T,N>::ConstReverseIterator;
 
      /* Current state */
-    constexpr bool isEmpty()                                                        const { return n == 0; }
-    constexpr bool isFull()                                                         const { return n == N; }
+    constexpr bool isEmpty()                                                        const { return storage.n == 0; }
+    constexpr bool isFull()                                                         const { return storage.n == N; }
 
      /* Capacity */
-    constexpr const std::size_t& length()                                           const { return n; }
+    constexpr const std::size_t& length()                                           const { return storage.n; }
     constexpr std::size_t maxLength()                                               const { return N; }
 
     /* Element access */
-    constexpr T& at( std::size_t index )                                                  { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return buffer.at( index ); }
-    constexpr const T& at( std::size_t index )                                      const { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return buffer.at( index ); }
+    constexpr T& at( std::size_t index )                                                  { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return storage.elements[index]; }
+    constexpr const T& at( std::size_t index )                                      const { EDF_ASSERTD(index < length(), "index needs to be within bounds of valid entries"); return storage.elements[index]; }
 
-    constexpr T& operator[]( std::size_t index )                                          { return buffer[index]; }
-    constexpr const T& operator[]( std::size_t index )                              const { return buffer[index]; }
+    constexpr T& operator[]( std::size_t index )                                          { return storage.elements[index]; }
+    constexpr const T& operator[]( std::size_t index )                              const { return storage.elements[index]; }
 
     constexpr T& front()                                                                  { return at( 0 ); }
     constexpr const T& front()                                                      const { return at( 0 ); }
 
-    constexpr T& back()                                                                   { return at( n - 1 ); }
-    constexpr const T& back()                                                       const { return at( n - 1 ); }
+    constexpr T& back()                                                                   { return at( storage.n - 1 ); }
+    constexpr const T& back()                                                       const { return at( storage.n - 1 ); }
 
-    constexpr T* data()                                                                   { return buffer.data(); }
-    constexpr const T* data()                                                       const { return buffer.data(); }
+    constexpr T* data()                                                                   { return storage.elements; }
+    constexpr const T* data()                                                       const { return storage.elements; }
 
     /* Operations */
-    constexpr void clear()                                                                { std::destroy( begin(), end() ); n = 0; }
+    constexpr void clear();
 
     constexpr void insert( std::size_t index, const T& value )                            { insert( ConstIterator(data() + index), value ); }
-    constexpr void insert( std::size_t index, T&& value )                                 { insert( ConstIterator(data() + index), value ); }
+    constexpr void insert( std::size_t index, T&& value )                                 { insert( ConstIterator(data() + index), std::move(value) ); }
     constexpr void insert( std::size_t index, std::size_t count, const T& value )         { insert( ConstIterator(data() + index), count, value ); }
     constexpr void insert( std::size_t index, std::initializer_list<T> iList )            { insert( ConstIterator(data() + index), iList ); }
     constexpr Iterator insert( ConstIterator pos, const T& value )                        { return insert( pos, 1, value ); }
@@ -76,22 +135,40 @@ public:
     constexpr Iterator erase( ConstIterator pos );
     constexpr Iterator erase( ConstIterator first, ConstIterator last );
 
-    constexpr void pushBack( const T& value )                                             { insert( end(), value ); }
-    constexpr void pushBack( T&& value )                                                  { emplaceBack(std::move(value) ); }
+    constexpr void pushBack( const T& value )                                             { emplaceBack( value ); }
+    constexpr void pushBack( T&& value )                                                  { emplaceBack( std::move(value) ); }
 
+    // Constructs directly at end(), without the element shifting of emplace()
     template<typename... Args>
-    constexpr T& emplaceBack(Args&&... args)                                              { return *emplace(end(), args...); }
+    constexpr T& emplaceBack( Args&&... args );
+
+    constexpr T popBack();
+
+    /* Bulk Operations */
+    // Replaces the contents with [first, last)
+    template<typename InputIt>
+    constexpr void assign( InputIt first, InputIt last )                                  { clear(); append( first, last ); }
+
+    // Adds [first, last) to the end. Contiguous ranges of trivially copyable T are a single memcpy
+    template<typename InputIt>
+    constexpr void append( InputIt first, InputIt last );
+
+    // Grows with value initialized (EX: 0) or copies of value elements, or shrinks by destroying elements from the end
+    constexpr void resize( std::size_t count );
+    constexpr void resize( std::size_t count, const T& value );
 
-    constexpr T popBack()                                                                 { EDF_ASSERTD(!isEmpty(), "Vector must not be empty in order to use popBack()"); T v(std::move(back())); --n; return v; }
+    // The unused slots after the last element, EX: for DMA to write into. Follow with commit() to add them
+    constexpr Span<T> spareCapacity()                                                     { return Span<T>( data() + storage.n, N - storage.n ); }
+    constexpr void commit( std::size_t count );
 
     /* Iterators */
     constexpr Iterator begin()                                                            { return Iterator( data() ); }
     constexpr ConstIterator begin()                                                 const { return ConstIterator( data() ); }
     constexpr ConstIterator cbegin()                                                const { return ConstIterator( data() ); }
 
-    constexpr Iterator end()                                                              { return Iterator( data() + n ); }
-    constexpr ConstIterator end()                                                   const { return ConstIterator( data() + n ); }
-    constexpr ConstIterator cend()                                                  const { return ConstIterator( data() + n ); }
+    constexpr Iterator end()                                                              { return Iterator( data() + storage.n ); }
+    constexpr ConstIterator end()                                                   const { return ConstIterator( data() + storage.n ); }
+    constexpr ConstIterator cend()                                                  const { return ConstIterator( data() + storage.n ); }
 
     constexpr ReverseIterator rbegin()                                                    { return ReverseIterator( end() ); }
     constexpr ConstReverseIterator rbegin()                                         const { return ConstReverseIterator( end() ); }
@@ -106,7 +183,7 @@ public:
 
 template<typename T, std::size_t N>
 constexpr bool operator==( const Vector<T, N>& lhs, const Vector<T, N>& rhs ) {
-    return std::equal( lhs.begin(), lhs.end(), rhs.begin() );
+    return std::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
 }
 
 } /* EDF */
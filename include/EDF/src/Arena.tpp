@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Arena.hpp"
+
+namespace EDF {
+
+/* Arena */
+
+template<std::size_t Bytes>
+void* Arena<Bytes>::
+allocate( std::size_t size, std::size_t alignment ) {
+    EDF_ASSERTD(isPow2( alignment ), "alignment must be a power of 2");
+    // Align the address rather than the offset, so alignments larger than the storage's own still hold
+    const auto first = reinterpret_cast<std::uintptr_t>(bytes);
+    const auto aligned = (first + offset + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+    const std::size_t start = aligned - first;
+    if( (start > Bytes) || (size > Bytes - start) ) {
+        return nullptr;
+    }
+    offset = start + size;
+    highWater = EDF::max( highWater, offset );
+    return bytes + start;
+}
+
+/* ArenaVector */
+
+template<typename T>
+template<std::size_t Bytes>
+ArenaVector<T>::
+ArenaVector( Arena<Bytes>& arena, std::size_t capacity ) :
+    elements(arena.template allocate<T>( capacity )),
+    n(0),
+    limit(capacity)
+{
+    // Not just a debug check, every later write would go through elements
+    EDF_ASSERT(elements != nullptr, "arena must have room for capacity elements");
+}
+
+template<typename T>
+template<typename... Args>
+constexpr typename ArenaVector<T>::Iterator ArenaVector<T>::
+emplace( ConstIterator pos, Args&&... args ) {
+    EDF_ASSERTD(pos >= begin(), "position must be valid");
+    EDF_ASSERTD(pos <= end(), "position must be valid");
+    EDF_ASSERTD(!isFull(), "must have enough space for new element");
+
+    Iterator position = begin() + (pos - begin());
+    impl::openGap( position, end(), 1 );
+    new (position) T(std::forward<Args>(args)...);
+    ++n;
+    return position;
+}
+
+template<typename T>
+template<typename... Args>
+constexpr T& ArenaVector<T>::
+emplaceBack( Args&&... args ) {
+    EDF_ASSERTD(!isFull(), "must have enough space for new element");
+
+    T* element = new (end()) T(std::forward<Args>(args)...);
+    ++n;
+    return *element;
+}
+
+template<typename T>
+constexpr typename ArenaVector<T>::Iterator ArenaVector<T>::
+erase( ConstIterator first, ConstIterator last ) {
+    EDF_ASSERTD(first >= begin(), "first must be valid");
+    EDF_ASSERTD(last <= end(), "last must be valid");
+    EDF_ASSERTD(first <= last, "first must not come after last");
+
+    Iterator position = begin() + (first - begin());
+    const auto count = static_cast<std::size_t>(last - first);
+    impl::shift( position + count, position, static_cast<std::size_t>(end() - (position + count)) );
+    std::destroy( end() - count, end() );   // the last count elements were moved from
+    n -= count;
+    return position;
+}
+
+template<typename T>
+constexpr T ArenaVector<T>::
+popBack() {
+    EDF_ASSERTD(!isEmpty(), "ArenaVector must not be empty in order to use popBack()");
+    T v(std::move(back()));
+    std::destroy_at( &back() );
+    --n;
+    return v;
+}
+
+template<typename T>
+template<typename InputIt>
+constexpr void ArenaVector<T>::
+append( InputIt first, InputIt last ) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr( std::is_base_of_v<std::forward_iterator_tag, Category> ) {
+        const auto count = static_cast<std::size_t>(std::distance( first, last ));
+        EDF_ASSERTD(count <= maxLength() - length(), "new values must be able to fit");
+        std::uninitialized_copy( first, last, end() );
+        n += count;
+    }
+    else {
+        for( ; first != last; ++first ) {
+            EDF_ASSERTD(!isFull(), "new values must be able to fit");
+            new (end()) T(*first);
+            ++n;
+        }
+    }
+}
+
+template<typename T>
+constexpr void ArenaVector<T>::
+commit( std::size_t count ) {
+    static_assert( std::is_trivially_copyable_v<T>, "commit() requires a trivially copyable T" );
+    EDF_ASSERTD(count <= maxLength() - length(), "count must fit in the spare capacity");
+    n += count;
+}
+
+/* ArenaString */
+
+template<std::size_t Bytes>
+ArenaString::
+ArenaString( Arena<Bytes>& arena, std::size_t maxLength ) :
+    buffer(arena.template allocate<char>( maxLength + 1 )),
+    size(0),
+    N(maxLength + 1)
+{
+    EDF_ASSERT(buffer != nullptr, "arena must have room for maxLength characters");
+    impl::make_string( buffer, size, N );
+}
+
+} /* EDF */
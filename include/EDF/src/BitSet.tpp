@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/BitSet.hpp"
+
+namespace EDF {
+
+template<std::size_t N>
+constexpr std::size_t BitSet<N>::
+findFrom( std::size_t wordIndex, uint64_t pending ) const {
+    while( pending == 0 ) {
+        if( ++wordIndex == WORDS ) {
+            return N;
+        }
+        pending = words[wordIndex];
+    }
+    return (wordIndex * BITS_PER_WORD) + countTrailingZeros( pending );
+}
+
+template<std::size_t N>
+constexpr bool BitSet<N>::
+any() const {
+    uint64_t combined = 0;
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        combined |= words[i];
+    }
+    return combined != 0;
+}
+
+template<std::size_t N>
+constexpr bool BitSet<N>::
+all() const {
+    uint64_t combined = ~uint64_t{0};
+    for( std::size_t i = 0; i < (WORDS - 1); ++i ) {
+        combined &= words[i];
+    }
+    return (combined == ~uint64_t{0}) && (words[WORDS - 1] == TAIL_MASK);
+}
+
+template<std::size_t N>
+constexpr std::size_t BitSet<N>::
+count() const {
+    std::size_t total = 0;
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        total += countSetBits( words[i] );
+    }
+    return total;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+setAll() {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] = ~uint64_t{0};
+    }
+    words[WORDS - 1] = TAIL_MASK;
+    return *this;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+resetAll() {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] = 0;
+    }
+    return *this;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+flipAll() {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] = ~words[i];
+    }
+    words[WORDS - 1] &= TAIL_MASK;
+    return *this;
+}
+
+template<std::size_t N>
+constexpr std::size_t BitSet<N>::
+findNextSet( std::size_t index ) const {
+    EDF_ASSERTD(index < N, "index must be less than N");
+    if( ++index == N ) {
+        return N;
+    }
+    // Drop the bits below index from its word
+    const std::size_t wordIndex = index / BITS_PER_WORD;
+    return findFrom( wordIndex, words[wordIndex] & ~(bit( index ) - 1) );
+}
+
+template<std::size_t N>
+constexpr std::size_t BitSet<N>::
+findFirstReset() const {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        const uint64_t reset = ~words[i];
+        if( reset != 0 ) {
+            const std::size_t index = (i * BITS_PER_WORD) + countTrailingZeros( reset );
+            return min( index, N );
+        }
+    }
+    return N;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+operator&=( const BitSet& other ) {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] &= other.words[i];
+    }
+    return *this;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+operator|=( const BitSet& other ) {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] |= other.words[i];
+    }
+    return *this;
+}
+
+template<std::size_t N>
+constexpr BitSet<N>& BitSet<N>::
+operator^=( const BitSet& other ) {
+    for( std::size_t i = 0; i < WORDS; ++i ) {
+        words[i] ^= other.words[i];
+    }
+    return *this;
+}
+
+} /* EDF */
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/FlatMap.hpp"
+
+namespace EDF {
+
+namespace impl {
+template<typename T, typename Key, typename Less>
+constexpr const T* lowerBound( const T* first, std::size_t length, const Key& key, Less less ) {
+    if( length == 0 ) {
+        return first;
+    }
+    // The answer is always in [first, first + length]
+    while( length > 1 ) {
+        const std::size_t half = length / 2;
+        first = less( first[half], key ) ? first + half : first;
+        length -= half;
+    }
+    return first + (less( *first, key ) ? 1 : 0);
+}
+
+template<typename T, std::size_t N, typename BidirIt, typename Less>
+constexpr void insertSorted( Vector<T, N>& elements, BidirIt first, BidirIt last, Less less ) {
+    // Construct the new elements at the end, then overwrite from the back with whichever of the two
+    // sorted ranges has the larger element. Existing elements only ever move towards the end.
+    T* existing = elements.end();
+    elements.append( first, last );
+    T* out = elements.end();
+    while( first != last ) {
+        --out;
+        if( (existing != elements.begin()) && less( *std::prev( last ), *(existing - 1) ) ) {
+            *out = std::move(*--existing);
+        }
+        else {
+            --last;
+            EDF_ASSERTD((existing == elements.begin()) || less( *(existing - 1), *last ), "new keys must not already be in the container");
+            *out = *last;
+        }
+    }
+}
+} /* impl */
+
+/* FlatMap */
+
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr V* FlatMap<K, V, N, Compare>::
+find( const K& key ) {
+    Iterator it = lowerBound( key );
+    return ((it != end()) && !Compare{}( key, it->key )) ? &it->value : nullptr;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr const V* FlatMap<K, V, N, Compare>::
+find( const K& key ) const {
+    ConstIterator it = lowerBound( key );
+    return ((it != end()) && !Compare{}( key, it->key )) ? &it->value : nullptr;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Value>
+constexpr V& FlatMap<K, V, N, Compare>::
+assign( const K& key, Value&& value ) {
+    Iterator it = lowerBound( key );
+    if( (it != end()) && !Compare{}( key, it->key ) ) {
+        it->value = std::forward<Value>(value);
+        return it->value;
+    }
+    return entries.emplace( it, Entry{ key, std::forward<Value>(value) } )->value;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename... Args>
+constexpr V& FlatMap<K, V, N, Compare>::
+emplace( const K& key, Args&&... args ) {
+    Iterator it = lowerBound( key );
+    if( (it != end()) && !Compare{}( key, it->key ) ) {
+        return it->value;
+    }
+    return entries.emplace( it, Entry{ key, V(std::forward<Args>(args)...) } )->value;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr bool FlatMap<K, V, N, Compare>::
+erase( const K& key ) {
+    Iterator it = lowerBound( key );
+    if( (it == end()) || Compare{}( key, it->key ) ) {
+        return false;
+    }
+    entries.erase( it );
+    return true;
+}
+
+/* FlatSet */
+
+template<typename K, std::size_t N, typename Compare>
+constexpr bool FlatSet<K, N, Compare>::
+insert( const K& key ) {
+    ConstIterator it = lowerBound( key );
+    if( (it != end()) && !less( key, *it ) ) {
+        return false;
+    }
+    keys.insert( it, key );
+    return true;
+}
+
+template<typename K, std::size_t N, typename Compare>
+constexpr bool FlatSet<K, N, Compare>::
+erase( const K& key ) {
+    ConstIterator it = lowerBound( key );
+    if( (it == end()) || less( key, *it ) ) {
+        return false;
+    }
+    keys.erase( it );
+    return true;
+}
+
+/* ConstFlatMap */
+
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr ConstFlatMap<K, V, N, Compare>::
+ConstFlatMap( const Entry (&list)[N] ) : entries{} {
+    // Insertion sort, tables are small and this usually runs at compile time
+    for( std::size_t i = 0; i < N; ++i ) {
+        std::size_t j = i;
+        for( ; (j > 0) && Compare{}( list[i].key, entries[j - 1].key ); --j ) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = list[i];
+    }
+    for( std::size_t i = 1; i < N; ++i ) {
+        EDF_ASSERTD(Compare{}( entries[i - 1].key, entries[i].key ), "keys must be unique");
+    }
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr const V* ConstFlatMap<K, V, N, Compare>::
+find( const K& key ) const {
+    ConstIterator it = lowerBound( key );
+    return ((it != end()) && !Compare{}( key, it->key )) ? &it->value : nullptr;
+}
+
+/* ConstFlatSet */
+
+template<typename K, std::size_t N, typename Compare>
+constexpr ConstFlatSet<K, N, Compare>::
+ConstFlatSet( const K (&list)[N] ) : keys{} {
+    for( std::size_t i = 0; i < N; ++i ) {
+        std::size_t j = i;
+        for( ; (j > 0) && less( list[i], keys[j - 1] ); --j ) {
+            keys[j] = keys[j - 1];
+        }
+        keys[j] = list[i];
+    }
+    for( std::size_t i = 1; i < N; ++i ) {
+        EDF_ASSERTD(less( keys[i - 1], keys[i] ), "keys must be unique");
+    }
+}
+
+} /* EDF */
@@ -9,90 +9,241 @@
 
 #include "EDF/Heap.hpp"
 #include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+
+#include <algorithm>
+#include <iterator>
 
 namespace EDF {
 
-template<typename T, std::size_t N, typename Compare>
-constexpr void Heap<T, N, Compare>::
-bubbleUp( std::size_t index ) {
-    while( index != 0 ) {
-        std::size_t parentIndex = (index - 1) / 2;
-        if( !Compare()( heap[parentIndex], heap[index] ) ) {
-            std::swap( heap[parentIndex], heap[index] );
-            index = parentIndex;
-        }
-        else{
+/*
+ * The sifts move a hole instead of swapping, each level costs one move instead of three.
+ * The caller writes value into the returned index once.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr std::size_t Heap<T, N, Compare, D>::
+siftUp( std::size_t hole, const T& value ) {
+    while( hole != 0 ) {
+        std::size_t parentIndex = (hole - 1) / D;
+        if( !compare( value, heap[parentIndex] ) ) {
             break;
         }
+        heap[hole] = std::move(heap[parentIndex]);
+        hole = parentIndex;
     }
+    return hole;
 }
 
-template<typename T, std::size_t N, typename Compare>
-constexpr void Heap<T, N, Compare>::
-bubbleDown( std::size_t index ) {
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr std::size_t Heap<T, N, Compare, D>::
+siftDown( std::size_t hole, const T& value, std::size_t n ) {
     while( true ) {
-        std::size_t leftChild = 2 * index + 1;
-        std::size_t rightChild = leftChild + 1;
-        std::size_t topIndex = index;
+        const std::size_t firstChild = D * hole + 1;
+        if( firstChild >= n ) {
+            break;
+        }
+        // Siblings are next to each other in memory, so picking the best of D children is cheap
+        const std::size_t lastChild = (n - firstChild > D) ? (firstChild + D) : n;
+        std::size_t child = firstChild;
+        for( std::size_t sibling = firstChild + 1; sibling < lastChild; ++sibling ) {
+            if( compare( heap[sibling], heap[child] ) ) {
+                child = sibling;
+            }
+        }
+        if( !compare( heap[child], value ) ) {
+            break;
+        }
+        heap[hole] = std::move(heap[child]);
+        hole = child;
+    }
+    return hole;
+}
 
-        if( (leftChild < heap.length()) && Compare()(heap[leftChild], heap[topIndex]) ) {
-            topIndex = leftChild;
+// Appends value and restores the heap, returns where value ended up
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+template<typename U>
+constexpr std::size_t Heap<T, N, Compare, D>::
+place( U&& value ) {
+    const std::size_t back = heap.length();
+    if( back != 0 ) {
+        const std::size_t parentIndex = (back - 1) / D;
+        if( compare( value, heap[parentIndex] ) ) {
+            // The parent is the first element to move down, it fills the new slot at the back
+            heap.pushBack( std::move(heap[parentIndex]) );
+            const std::size_t hole = siftUp( parentIndex, value );
+            heap[hole] = std::forward<U>(value);
+            return hole;
         }
-        if( (rightChild < heap.length()) && Compare()(heap[rightChild], heap[topIndex]) ) {
-            topIndex = rightChild;
+    }
+    heap.pushBack( std::forward<U>(value) );
+    return back;
+}
+
+/*
+ * Floyd's heapify, O(n). Sifts down nodes with children from the last one back to the root.
+ * Only the elements from first onwards can be out of place, so only their ancestors need to sift,
+ * which is a range of indexes on each level.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr void Heap<T, N, Compare, D>::
+heapify( std::size_t first ) {
+    // There are ceil((length - 1) / D) nodes with children
+    const std::size_t parents = (length() + D - 2) / D;
+    if( parents == 0 ) {
+        return;
+    }
+    std::size_t low = (first == 0) ? 0 : (first - 1) / D;
+    std::size_t high = parents - 1;
+    while( true ) {
+        for( std::size_t k = high + 1; k > low; --k ) {
+            T value = std::move(heap[k - 1]);
+            const std::size_t hole = siftDown( k - 1, value, length() );
+            heap[hole] = std::move(value);
         }
-        if( topIndex == index ) {
+        if( low == 0 ) {
             break;
         }
-        std::swap(heap[index], heap[topIndex]);
-        index = topIndex;
+        high = EDF::min( (high - 1) / D, low - 1 );
+        low = (low - 1) / D;
     }
 }
 
-template<typename T, std::size_t N, typename Compare>
-template<typename... I>
-constexpr Heap<T,N,Compare>::
-Heap( I... iList ) : heap{iList...} {
-    for( std::size_t k = length() / 2; k > 0; --k ) {
-        bubbleDown( k - 1 );
+// Number of levels in a heap of n elements
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr std::size_t Heap<T, N, Compare, D>::
+depth( std::size_t n ) {
+    std::size_t levels = 0;
+    while( n != 0 ) {
+        n /= D;
+        ++levels;
     }
+    return levels;
 }
 
-template<typename T, std::size_t N, typename Compare>
-constexpr void Heap<T, N, Compare>::
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+template<typename... I>
+constexpr Heap<T, N, Compare, D>::
+Heap( I... iList ) : heap{iList...}, compare{} {
+    heapify( 0 );
+}
+
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr void Heap<T, N, Compare, D>::
 push( const T& value ) {
     EDF_ASSERTD( !isFull(), "Heap must not be full in order to use push()" );
-    heap.pushBack( value );
-    bubbleUp( heap.length() - 1 );
+    place( value );
 }
 
-template<typename T, std::size_t N, typename Compare>
-constexpr void Heap<T, N, Compare>::
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr void Heap<T, N, Compare, D>::
 push( const T&& value ) {
     EDF_ASSERTD( !isFull(), "Heap must not be full in order to use push()" );
-    heap.pushBack( std::move(value) );
-    bubbleUp( heap.length() - 1 );
+    place( std::move(value) );
 }
 
-template<typename T, std::size_t N, typename Compare>
+template<typename T, std::size_t N, typename Compare, std::size_t D>
 template<typename... Args>
-constexpr T& Heap<T, N, Compare>::
+constexpr T& Heap<T, N, Compare, D>::
 emplace( Args&&... args ) {
     EDF_ASSERTD( !isFull(), "Heap must not be full in order to use emplace()" );
-    auto& value = heap.emplaceBack( std::forward<Args>(args)... );
-    bubbleUp( heap.length() - 1 );
-    return value;
+    return heap[place( T(std::forward<Args>(args)...) )];
 }
 
-template<typename T, std::size_t N, typename Compare>
-constexpr T Heap<T, N, Compare>::
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr T Heap<T, N, Compare, D>::
 pop() {
     EDF_ASSERTD( !isEmpty(), "Heap must not be empty in order to use pop()" );
     T topValue = std::move(heap.front());
-    heap.front() = std::move(heap.back());
-    heap.popBack();
-    bubbleDown( 0 );
+    T last = heap.popBack();
+    if( !isEmpty() ) {
+        const std::size_t hole = siftDown( 0, last, length() );
+        heap[hole] = std::move(last);
+    }
     return topValue;
 }
 
-} /* EDF */
\ No newline at end of file
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+template<typename InputIt>
+constexpr void Heap<T, N, Compare, D>::
+assign( InputIt first, InputIt last ) {
+    heap.clear();
+    for( ; first != last; ++first ) {
+        EDF_ASSERTD( !isFull(), "Heap must be able to hold every element in order to use assign()" );
+        heap.pushBack( *first );
+    }
+    heapify( 0 );
+}
+
+/*
+ * Sifting each new element up costs at most depth() moves each, re-heapifying costs about
+ * length() in total. Pick the smaller worst case.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+template<typename ForwardIt>
+constexpr void Heap<T, N, Compare, D>::
+pushBatch( ForwardIt first, ForwardIt last ) {
+    const auto count = static_cast<std::size_t>(std::distance( first, last ));
+    EDF_ASSERTD( count <= maxLength() - length(), "Heap must be able to hold every element in order to use pushBatch()" );
+    const std::size_t oldLength = length();
+    const std::size_t newLength = oldLength + count;
+    if( count * depth( newLength ) <= newLength ) {
+        for( ; first != last; ++first ) {
+            place( *first );
+        }
+        return;
+    }
+    for( ; first != last; ++first ) {
+        heap.pushBack( *first );
+    }
+    heapify( oldLength );
+}
+
+/*
+ * Best first walk of the implicit tree. The frontier holds the indexes of elements that could be next,
+ * the root to start, then the children of every element written out. It never holds more than
+ * 1 + k * (D - 1) indexes, so the cost is O(k log k) no matter how big the heap is.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+template<std::size_t K, typename OutputIt>
+constexpr OutputIt Heap<T, N, Compare, D>::
+topK( std::size_t k, OutputIt out ) const {
+    EDF_ASSERTD( k <= K, "k must be <= K in order to use topK()" );
+    struct IndexCompare {
+        const Heap* owner;
+        constexpr bool operator()( std::size_t lhs, std::size_t rhs ) const { return owner->compare( owner->heap[lhs], owner->heap[rhs] ); }
+    };
+    Heap<std::size_t, 1 + K * (D - 1), IndexCompare> frontier( IndexCompare{ this } );
+
+    if( !isEmpty() ) {
+        frontier.push( 0 );
+    }
+    for( ; (k != 0) && !frontier.isEmpty(); --k ) {
+        const std::size_t index = frontier.pop();
+        *out = heap[index];
+        ++out;
+        const std::size_t firstChild = D * index + 1;
+        for( std::size_t child = firstChild; (child < firstChild + D) && (child < length()); ++child ) {
+            frontier.push( child );
+        }
+    }
+    return out;
+}
+
+/*
+ * Heap sort leaves the elements in reverse pop order, reversing puts them in pop order.
+ * An array sorted in pop order is still a valid heap, so nothing else has to change.
+ */
+template<typename T, std::size_t N, typename Compare, std::size_t D>
+constexpr Span<const T> Heap<T, N, Compare, D>::
+sortInto() {
+    for( std::size_t end = length(); end > 1; --end ) {
+        T value = std::move(heap[end - 1]);
+        heap[end - 1] = std::move(heap.front());
+        const std::size_t hole = siftDown( 0, value, end - 1 );
+        heap[hole] = std::move(value);
+    }
+    std::reverse( heap.begin(), heap.end() );
+    return Span<const T>( heap.data(), length() );
+}
+
+} /* EDF */
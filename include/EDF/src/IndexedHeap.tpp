@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/IndexedHeap.hpp"
+#include "EDF/Assert.hpp"
+
+#include <utility>
+
+namespace EDF {
+
+/* Free handles are kept in a list threaded through indexOf, so no extra storage is needed */
+template<typename T, std::size_t N, typename Compare>
+constexpr typename IndexedHeap<T, N, Compare>::Handle IndexedHeap<T, N, Compare>::
+acquireHandle() {
+    if( freeHandle != INVALID_HANDLE ) {
+        Handle handle = freeHandle;
+        freeHandle = indexOf[handle];
+        return handle;
+    }
+    return unusedHandle++;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr void IndexedHeap<T, N, Compare>::
+releaseHandle( Handle handle ) {
+    indexOf[handle] = freeHandle;
+    freeHandle = handle;
+}
+
+/*
+ * Same hole based sifts as Heap, every element that moves takes its handle along,
+ * and the handle's index is updated to match.
+ */
+template<typename T, std::size_t N, typename Compare>
+constexpr std::size_t IndexedHeap<T, N, Compare>::
+siftUp( std::size_t hole, const T& value ) {
+    while( hole != 0 ) {
+        std::size_t parentIndex = (hole - 1) / 2;
+        if( !compare( value, heap[parentIndex] ) ) {
+            break;
+        }
+        heap[hole] = std::move(heap[parentIndex]);
+        settle( hole, handleOf[parentIndex] );
+        hole = parentIndex;
+    }
+    return hole;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr std::size_t IndexedHeap<T, N, Compare>::
+siftDown( std::size_t hole, const T& value ) {
+    const std::size_t n = heap.length();
+    while( true ) {
+        std::size_t child = 2 * hole + 1;
+        if( child >= n ) {
+            break;
+        }
+        if( (child + 1 < n) && compare( heap[child + 1], heap[child] ) ) {
+            ++child;
+        }
+        if( !compare( heap[child], value ) ) {
+            break;
+        }
+        heap[hole] = std::move(heap[child]);
+        settle( hole, handleOf[child] );
+        hole = child;
+    }
+    return hole;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr void IndexedHeap<T, N, Compare>::
+settle( std::size_t index, Handle handle ) {
+    handleOf[index] = handle;
+    indexOf[handle] = index;
+}
+
+template<typename T, std::size_t N, typename Compare>
+template<typename U>
+constexpr typename IndexedHeap<T, N, Compare>::Handle IndexedHeap<T, N, Compare>::
+place( U&& value ) {
+    const Handle handle = acquireHandle();
+    const std::size_t back = heap.length();
+    if( back != 0 ) {
+        const std::size_t parentIndex = (back - 1) / 2;
+        if( compare( value, heap[parentIndex] ) ) {
+            heap.pushBack( std::move(heap[parentIndex]) );
+            settle( back, handleOf[parentIndex] );
+            const std::size_t hole = siftUp( parentIndex, value );
+            heap[hole] = std::forward<U>(value);
+            settle( hole, handle );
+            return handle;
+        }
+    }
+    heap.pushBack( std::forward<U>(value) );
+    settle( back, handle );
+    return handle;
+}
+
+// Moves the last element into index, then sifts it whichever way it needs to go
+template<typename T, std::size_t N, typename Compare>
+constexpr T IndexedHeap<T, N, Compare>::
+removeAt( std::size_t index ) {
+    releaseHandle( handleOf[index] );
+    T removed = std::move(heap[index]);
+    const std::size_t lastIndex = heap.length() - 1;
+    const Handle lastHandle = handleOf[lastIndex];
+    T last = heap.popBack();
+    if( index != lastIndex ) {
+        std::size_t hole = index;
+        if( (hole != 0) && compare( last, heap[(hole - 1) / 2] ) ) {
+            hole = siftUp( hole, last );
+        }
+        else {
+            hole = siftDown( hole, last );
+        }
+        heap[hole] = std::move(last);
+        settle( hole, lastHandle );
+    }
+    return removed;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr bool IndexedHeap<T, N, Compare>::
+contains( Handle handle ) const {
+    if( handle >= unusedHandle ) {
+        return false;
+    }
+    // Free handles hold the next free handle in indexOf, which can't point back at them
+    const std::size_t index = indexOf[handle];
+    return (index < heap.length()) && (handleOf[index] == handle);
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr const T& IndexedHeap<T, N, Compare>::
+at( Handle handle ) const {
+    EDF_ASSERTD( contains( handle ), "handle must refer to an element in the heap" );
+    return heap[indexOf[handle]];
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr typename IndexedHeap<T, N, Compare>::Handle IndexedHeap<T, N, Compare>::
+push( const T& value ) {
+    EDF_ASSERTD( !isFull(), "IndexedHeap must not be full in order to use push()" );
+    return place( value );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr typename IndexedHeap<T, N, Compare>::Handle IndexedHeap<T, N, Compare>::
+push( T&& value ) {
+    EDF_ASSERTD( !isFull(), "IndexedHeap must not be full in order to use push()" );
+    return place( std::move(value) );
+}
+
+template<typename T, std::size_t N, typename Compare>
+template<typename... Args>
+constexpr typename IndexedHeap<T, N, Compare>::Handle IndexedHeap<T, N, Compare>::
+emplace( Args&&... args ) {
+    EDF_ASSERTD( !isFull(), "IndexedHeap must not be full in order to use emplace()" );
+    return place( T(std::forward<Args>(args)...) );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr T IndexedHeap<T, N, Compare>::
+pop() {
+    EDF_ASSERTD( !isEmpty(), "IndexedHeap must not be empty in order to use pop()" );
+    return removeAt( 0 );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr void IndexedHeap<T, N, Compare>::
+update( Handle handle, const T& value ) {
+    EDF_ASSERTD( contains( handle ), "handle must refer to an element in the heap" );
+    const std::size_t index = indexOf[handle];
+    const std::size_t hole = compare( value, heap[index] ) ? siftUp( index, value ) : siftDown( index, value );
+    heap[hole] = value;
+    settle( hole, handle );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr void IndexedHeap<T, N, Compare>::
+update( Handle handle, T&& value ) {
+    EDF_ASSERTD( contains( handle ), "handle must refer to an element in the heap" );
+    const std::size_t index = indexOf[handle];
+    const std::size_t hole = compare( value, heap[index] ) ? siftUp( index, value ) : siftDown( index, value );
+    heap[hole] = std::move(value);
+    settle( hole, handle );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr T IndexedHeap<T, N, Compare>::
+erase( Handle handle ) {
+    EDF_ASSERTD( contains( handle ), "handle must refer to an element in the heap" );
+    return removeAt( indexOf[handle] );
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr void IndexedHeap<T, N, Compare>::
+clear() {
+    heap.clear();
+    freeHandle = INVALID_HANDLE;
+    unusedHandle = 0;
+}
+
+} /* EDF */
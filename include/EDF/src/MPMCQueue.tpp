@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/MPMCQueue.hpp"
+#include "EDF/Math.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace EDF {
+
+template<typename T, std::size_t N>
+constexpr std::size_t MPMCQueue<T, N>::
+slot( std::size_t position ) {
+    if constexpr( isPow2( N ) ) {
+        return position & WRAP;
+    }
+    return position % N;
+}
+
+/*
+ * A slot whose sequence equals a position is free for the producer that claims that position.
+ * After pushing, the sequence becomes position+1, which is what the consumer of that position waits for.
+ * After popping, the sequence becomes position+N, freeing the slot for the next lap around the buffer.
+ */
+template<typename T, std::size_t N>
+MPMCQueue<T, N>::
+MPMCQueue() : head(0), tail(0), buffer{} {
+    for( std::size_t k = 0; k < N; ++k ) {
+        buffer[k].sequence.store( k, std::memory_order_relaxed );
+    }
+}
+
+template<typename T, std::size_t N>
+std::size_t MPMCQueue<T, N>::
+length() const {
+    const std::size_t h = head.load( std::memory_order_acquire );
+    const std::size_t t = tail.load( std::memory_order_acquire );
+    // head and tail are read separately, clamp the snapshot to something that could have been true
+    if( t <= h ) {
+        return 0;
+    }
+    return (t - h > N) ? N : (t - h);
+}
+
+template<typename T, std::size_t N>
+template<typename Store>
+bool MPMCQueue<T, N>::
+claimPush( Store&& store ) {
+    std::size_t position = tail.load( std::memory_order_relaxed );
+    while( true ) {
+        Slot& s = buffer[slot( position )];
+        const std::size_t sequence = s.sequence.load( std::memory_order_acquire );
+        const auto difference = static_cast<std::make_signed_t<std::size_t>>(sequence - position);
+        if( difference == 0 ) {
+            if( tail.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+                store( s.value );
+                s.sequence.store( position + 1, std::memory_order_release );
+                return true;
+            }
+            // position was reloaded by the failed compare exchange
+        }
+        else if( difference < 0 ) {
+            // The slot still holds the element from the previous lap
+            return false;
+        }
+        else {
+            position = tail.load( std::memory_order_relaxed );
+        }
+    }
+}
+
+template<typename T, std::size_t N>
+bool MPMCQueue<T, N>::
+push( const T& value ) {
+    return claimPush( [&]( T& destination ){ destination = value; } );
+}
+
+template<typename T, std::size_t N>
+bool MPMCQueue<T, N>::
+push( T&& value ) {
+    return claimPush( [&]( T& destination ){ destination = std::move(value); } );
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+bool MPMCQueue<T, N>::
+emplace( Args&&... args ) {
+    return claimPush( [&]( T& destination ){ new (&destination) T(std::forward<Args>(args)...); } );
+}
+
+template<typename T, std::size_t N>
+bool MPMCQueue<T, N>::
+pop( T& value ) {
+    std::size_t position = head.load( std::memory_order_relaxed );
+    while( true ) {
+        Slot& s = buffer[slot( position )];
+        const std::size_t sequence = s.sequence.load( std::memory_order_acquire );
+        const auto difference = static_cast<std::make_signed_t<std::size_t>>(sequence - (position + 1));
+        if( difference == 0 ) {
+            if( head.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+                value = std::move(s.value);
+                s.sequence.store( position + N, std::memory_order_release );
+                return true;
+            }
+        }
+        else if( difference < 0 ) {
+            // The slot hasn't been pushed to yet this lap
+            return false;
+        }
+        else {
+            position = head.load( std::memory_order_relaxed );
+        }
+    }
+}
+
+} /* EDF */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Map.hpp"
+
+namespace EDF {
+
+template<typename K, typename V, std::size_t N, typename H>
+bool Map<K, V, N, H>::
+probe( const K& key, std::size_t& index, std::size_t& distance ) const {
+    index = home( key );
+    distance = 1;
+    // An empty slot, or an entry closer to home than key would be, means key isn't in the map
+    while( distances[index] >= distance ) {
+        if( (distances[index] == distance) && (entries[index].key == key) ) {
+            return true;
+        }
+        index = next( index );
+        ++distance;
+    }
+    return false;
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+std::size_t Map<K, V, N, H>::
+locate( const K& key ) const {
+    std::size_t index;
+    std::size_t distance;
+    return probe( key, index, distance ) ? index : SLOTS;
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+void Map<K, V, N, H>::
+moveEntry( std::size_t from, std::size_t to ) {
+    new (&entries[to]) Entry(std::move(entries[from]));
+    std::destroy_at( &entries[from] );
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+template<typename... Args>
+V& Map<K, V, N, H>::
+place( std::size_t index, std::size_t distance, const K& key, Args&&... args ) {
+    EDF_ASSERTD(!isFull(), "must have enough space for new entry");
+
+    // args may refer to an entry that is about to move, so build the entry before shifting
+    Entry entry{ key, V(std::forward<Args>(args)...) };
+    // Every entry from index up to the next empty slot moves 1 slot further from home, keeping their order
+    std::size_t empty = index;
+    while( distances[empty] != 0 ) {
+        empty = next( empty );
+    }
+    for( ; empty != index; empty = previous( empty ) ) {
+        EDF_ASSERTD(distances[previous( empty )] < UINT8_MAX, "entry must stay within 255 slots of home");
+        moveEntry( previous( empty ), empty );
+        distances[empty] = static_cast<uint8_t>(distances[previous( empty )] + 1);
+    }
+    EDF_ASSERTD(distance <= UINT8_MAX, "entry must stay within 255 slots of home");
+    new (&entries[index]) Entry(std::move(entry));
+    distances[index] = static_cast<uint8_t>(distance);
+    ++n;
+    return entries[index].value;
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+template<typename Value>
+V& Map<K, V, N, H>::
+assign( const K& key, Value&& value ) {
+    std::size_t index;
+    std::size_t distance;
+    if( probe( key, index, distance ) ) {
+        entries[index].value = std::forward<Value>(value);
+        return entries[index].value;
+    }
+    return place( index, distance, key, std::forward<Value>(value) );
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+template<typename... Args>
+V& Map<K, V, N, H>::
+emplace( const K& key, Args&&... args ) {
+    std::size_t index;
+    std::size_t distance;
+    if( probe( key, index, distance ) ) {
+        return entries[index].value;
+    }
+    return place( index, distance, key, std::forward<Args>(args)... );
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+bool Map<K, V, N, H>::
+erase( const K& key ) {
+    std::size_t index = locate( key );
+    if( index == SLOTS ) {
+        return false;
+    }
+    std::destroy_at( &entries[index] );
+    // Entries after it that aren't home move 1 slot closer, until an empty slot or an entry that is home
+    for( std::size_t following = next( index ); distances[following] > 1; index = following, following = next( following ) ) {
+        moveEntry( following, index );
+        distances[index] = static_cast<uint8_t>(distances[following] - 1);
+    }
+    distances[index] = 0;
+    --n;
+    return true;
+}
+
+template<typename K, typename V, std::size_t N, typename H>
+void Map<K, V, N, H>::
+clear() {
+    if constexpr( !std::is_trivially_destructible_v<Entry> ) {
+        for( std::size_t index = 0; index < SLOTS; ++index ) {
+            if( distances[index] != 0 ) {
+                std::destroy_at( &entries[index] );
+            }
+        }
+    }
+    distances.clear();
+    n = 0;
+}
+
+} /* EDF */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/OverwriteQueue.hpp"
+#include "EDF/Math.hpp"
+
+#include <utility>
+
+namespace EDF {
+
+template<typename T, std::size_t N>
+constexpr std::size_t OverwriteQueue<T, N>::
+wrap( std::size_t index ) {
+    if constexpr( isPow2( N ) ) {
+        return index & WRAP;
+    }
+    return index % N;
+}
+
+/* Returns the slot for a new element, dropping the oldest element when full */
+template<typename T, std::size_t N>
+constexpr std::size_t OverwriteQueue<T, N>::
+nextSlot() {
+    const std::size_t slot = wrap( head + n );
+    if( isFull() ) {
+        head = wrap( head + 1 );
+        ++nOverwritten;
+    }
+    else {
+        ++n;
+    }
+    return slot;
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+constexpr T& OverwriteQueue<T, N>::
+emplace( Args&&... args ) {
+    T* value = new (&buffer[nextSlot()]) T(std::forward<Args>(args)...);
+    return *value;
+}
+
+template<typename T, std::size_t N>
+constexpr T OverwriteQueue<T, N>::
+pop() {
+    EDF_ASSERTD( !isEmpty(), "OverwriteQueue must not be empty in order to use pop()" );
+    T tmp = std::move(buffer[head]);
+    head = wrap( head + 1 );
+    --n;
+    return tmp;
+}
+
+} /* EDF */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Pool.hpp"
+
+namespace EDF {
+
+/* impl::AtomicIndexLists */
+
+template<std::size_t N>
+typename impl::AtomicIndexLists<N>::Index impl::AtomicIndexLists<N>::
+take( Head& head ) {
+    Word h = head.word.load( std::memory_order_acquire );
+    while( (h & INDEX_MASK) != NONE ) {
+        const auto index = static_cast<Index>(h & INDEX_MASK);
+        const Index following = next[index].load( std::memory_order_relaxed );
+        // Fails if any other thread changed this list since h was read, even back to the same index
+        if( head.word.compare_exchange_weak( h, link( h, following ), std::memory_order_acquire, std::memory_order_acquire ) ) {
+            return index;
+        }
+    }
+    return NONE;
+}
+
+template<std::size_t N>
+void impl::AtomicIndexLists<N>::
+give( Head& head, Index index ) {
+    Word h = head.word.load( std::memory_order_relaxed );
+    do {
+        next[index].store( static_cast<Index>(h & INDEX_MASK), std::memory_order_relaxed );
+    } while( !head.word.compare_exchange_weak( h, link( h, index ), std::memory_order_release, std::memory_order_relaxed ) );
+}
+
+template<std::size_t N>
+typename impl::AtomicIndexLists<N>::Index impl::AtomicIndexLists<N>::
+allocate() {
+    const Index index = take( freeHead );
+    if( index != NONE ) {
+        return index;
+    }
+    Index fresh = unusedSlot.load( std::memory_order_relaxed );
+    while( fresh != N ) {
+        if( unusedSlot.compare_exchange_weak( fresh, static_cast<Index>(fresh + 1), std::memory_order_relaxed ) ) {
+            return fresh;
+        }
+    }
+    return NONE;
+}
+
+/* Pool */
+
+template<typename T, std::size_t N>
+std::size_t Pool<T, N>::
+indexOf( const T* pointer ) const {
+    EDF_ASSERTD( owns( pointer ), "pointer must come from this Pool" );
+    return static_cast<std::size_t>(reinterpret_cast<const Slot*>(pointer) - slots);
+}
+
+template<typename T, std::size_t N>
+bool Pool<T, N>::
+owns( const T* pointer ) const {
+    const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+    const auto first = reinterpret_cast<std::uintptr_t>(slots);
+    return (address >= first) && (address < first + sizeof(Slot) * N) && ((address - first) % sizeof(Slot) == 0);
+}
+
+template<typename T, std::size_t N>
+T* Pool<T, N>::
+allocate() {
+    Index index;
+    if( freeSlot != NONE ) {
+        index = freeSlot;
+        freeSlot = slots[index].next;
+    }
+    else if( unusedSlot != N ) {
+        index = unusedSlot++;
+    }
+    else {
+        return nullptr;
+    }
+    ++n;
+    highWater = EDF::max( highWater, n );
+    return reinterpret_cast<T*>(slots[index].bytes);
+}
+
+template<typename T, std::size_t N>
+void Pool<T, N>::
+deallocate( T* pointer ) {
+    if( pointer == nullptr ) {
+        return;
+    }
+    const auto index = static_cast<Index>(indexOf( pointer ));
+    slots[index].next = freeSlot;
+    freeSlot = index;
+    --n;
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+T* Pool<T, N>::
+construct( Args&&... args ) {
+    T* pointer = allocate();
+    if( pointer != nullptr ) {
+        new (pointer) T(std::forward<Args>(args)...);
+    }
+    return pointer;
+}
+
+template<typename T, std::size_t N>
+void Pool<T, N>::
+destroy( T* pointer ) {
+    if( pointer == nullptr ) {
+        return;
+    }
+    pointer->~T();
+    deallocate( pointer );
+}
+
+/* AtomicPool */
+
+template<typename T, std::size_t N>
+std::size_t AtomicPool<T, N>::
+indexOf( const T* pointer ) const {
+    EDF_ASSERTD( owns( pointer ), "pointer must come from this AtomicPool" );
+    return static_cast<std::size_t>(reinterpret_cast<const Slot*>(pointer) - slots);
+}
+
+template<typename T, std::size_t N>
+bool AtomicPool<T, N>::
+owns( const T* pointer ) const {
+    const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+    const auto first = reinterpret_cast<std::uintptr_t>(slots);
+    return (address >= first) && (address < first + sizeof(Slot) * N) && ((address - first) % sizeof(Slot) == 0);
+}
+
+template<typename T, std::size_t N>
+T* AtomicPool<T, N>::
+allocate() {
+    const Index index = lists.allocate();
+    if( index == Lists::NONE ) {
+        return nullptr;
+    }
+    const std::size_t length = n.fetch_add( 1, std::memory_order_relaxed ) + 1;
+    std::size_t mark = highWater.load( std::memory_order_relaxed );
+    while( (length > mark) && !highWater.compare_exchange_weak( mark, length, std::memory_order_relaxed ) ) {}
+    return reinterpret_cast<T*>(slots[index].bytes);
+}
+
+template<typename T, std::size_t N>
+void AtomicPool<T, N>::
+deallocate( T* pointer ) {
+    if( pointer == nullptr ) {
+        return;
+    }
+    const auto index = static_cast<Index>(indexOf( pointer ));
+    n.fetch_sub( 1, std::memory_order_relaxed );
+    lists.deallocate( index );
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+T* AtomicPool<T, N>::
+construct( Args&&... args ) {
+    T* pointer = allocate();
+    if( pointer != nullptr ) {
+        new (pointer) T(std::forward<Args>(args)...);
+    }
+    return pointer;
+}
+
+template<typename T, std::size_t N>
+void AtomicPool<T, N>::
+destroy( T* pointer ) {
+    if( pointer == nullptr ) {
+        return;
+    }
+    pointer->~T();
+    deallocate( pointer );
+}
+
+} /* EDF */
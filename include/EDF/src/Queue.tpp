@@ -10,148 +10,301 @@
 #include "EDF/Queue.hpp"
 #include "EDF/Math.hpp"
 
+#include <algorithm>
+
 namespace EDF {
 
-template<typename T, std::size_t N>
-constexpr bool Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::size_t Queue<T, N, M>::
+slot( std::size_t index ) {
+    if constexpr( M == QueueMode::freeRunning ) {
+        return index & WRAP;
+    }
+    return index;
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::size_t Queue<T, N, M>::
+advance( std::size_t index, std::size_t count ) {
+    if constexpr( M == QueueMode::freeRunning ) {
+        return index + count;
+    }
+    if constexpr( isPow2( N ) ) {
+        return (index + count) & WRAP;
+    }
+    return (index + count) % N;
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr bool Queue<T, N, M>::
 isFull() const {
+    if constexpr( M == QueueMode::freeRunning ) {
+        return (tail - head) == N;
+    }
     if constexpr( isPow2( N ) ) {
         return head == ((tail+1) & WRAP);
     }
     return head == ((tail+1) % N);
 }
 
-template<typename T, std::size_t N>
-constexpr std::size_t Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::size_t Queue<T, N, M>::
 length() const {
+    if constexpr( M == QueueMode::freeRunning ) {
+        return tail - head;
+    }
     if constexpr( isPow2( N ) ) {
         return (tail - head) & WRAP;
     }
-    return (tail - head) % N;
+    return (tail + N - head) % N;
 }
 
-template<typename T, std::size_t N>
-constexpr void Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
 push( const T& value ) {
     EDF_ASSERTD( !isFull(), "Queue must not be full in order to use push()" );
-    buffer[tail] = value;
-    if constexpr( isPow2( N ) ) {
-        tail = (tail+1) & WRAP;
-    }
-    else{
-        tail = (tail+1) % N;
-    }
+    buffer[slot( tail )] = value;
+    tail = advance( tail, 1 );
 }
 
-template<typename T, std::size_t N>
-constexpr void Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
 push( const T&& value ) {
     EDF_ASSERTD( !isFull(), "Queue must not be full in order to use push()" );
-    buffer[tail] = std::move(value);
-    if constexpr( isPow2( N ) ) {
-        tail = (tail+1) & WRAP;
-    }
-    else{
-        tail = (tail+1) % N;
-    }
+    buffer[slot( tail )] = std::move(value);
+    tail = advance( tail, 1 );
 }
 
-template<typename T, std::size_t N>
+template<typename T, std::size_t N, QueueMode M>
 template<typename... Args>
-constexpr T& Queue<T, N>::
+constexpr T& Queue<T, N, M>::
 emplace( Args&&... args ) {
     EDF_ASSERTD( !isFull(), "Queue must not be full in order to use emplace()" );
-    new (&buffer[tail]) T(std::forward<Args>(args)...);
-    if constexpr( isPow2( N ) ) {
-        tail = (tail+1) & WRAP;
-    }
-    else{
-        tail = (tail+1) % N;
-    }
-    return buffer[tail];
+    T* value = new (&buffer[slot( tail )]) T(std::forward<Args>(args)...);
+    tail = advance( tail, 1 );
+    return *value;
 }
 
-template<typename T, std::size_t N>
-constexpr T Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr T Queue<T, N, M>::
 pop() {
     EDF_ASSERTD( !isEmpty(), "Queue must not be empty in order to use pop()" );
-    T tmp = buffer[head];
-    if constexpr( isPow2( N ) ) {
-        head = (head+1) & WRAP;
+    T tmp = buffer[slot( head )];
+    head = advance( head, 1 );
+    return tmp;
+}
+
+/* Bulk operations */
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push( const T* values, std::size_t count ) {
+    EDF_ASSERTD( count <= (maxLength() - length()), "Queue must have room for count elements in order to use push()" );
+    const std::size_t first = EDF::min( count, N - slot( tail ) );
+    std::copy_n( values, first, buffer.data() + slot( tail ) );
+    std::copy_n( values + first, count - first, buffer.data() );
+    tail = advance( tail, count );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+pop( T* values, std::size_t count ) {
+    EDF_ASSERTD( count <= length(), "Queue must have at least count elements in order to use pop()" );
+    const std::size_t first = EDF::min( count, N - slot( head ) );
+    std::move( buffer.data() + slot( head ), buffer.data() + slot( head ) + first, values );
+    std::move( buffer.data(), buffer.data() + (count - first), values + first );
+    head = advance( head, count );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr typename Queue<T, N, M>::Spans Queue<T, N, M>::
+readableSpans() {
+    const std::size_t count = length();
+    const std::size_t first = EDF::min( count, N - slot( head ) );
+    return Spans{ Span<T>( buffer.data() + slot( head ), first ), Span<T>( buffer.data(), count - first ) };
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr typename Queue<T, N, M>::ConstSpans Queue<T, N, M>::
+readableSpans() const {
+    const std::size_t count = length();
+    const std::size_t first = EDF::min( count, N - slot( head ) );
+    return ConstSpans{ Span<const T>( buffer.data() + slot( head ), first ), Span<const T>( buffer.data(), count - first ) };
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr typename Queue<T, N, M>::Spans Queue<T, N, M>::
+writableSpans() {
+    const std::size_t count = maxLength() - length();
+    const std::size_t first = EDF::min( count, N - slot( tail ) );
+    return Spans{ Span<T>( buffer.data() + slot( tail ), first ), Span<T>( buffer.data(), count - first ) };
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+commitPush( std::size_t count ) {
+    EDF_ASSERTD( count <= (maxLength() - length()), "count must not exceed the writable elements" );
+    tail = advance( tail, count );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+commitPop( std::size_t count ) {
+    EDF_ASSERTD( count <= length(), "count must not exceed the readable elements" );
+    head = advance( head, count );
+}
+
+/* uint8_t specialized member functions */
+
+/* Asserts once for the whole word, and reads it with a single load unless it wraps */
+template<typename T, std::size_t N, QueueMode M>
+template<typename U, Endian E>
+constexpr U Queue<T, N, M>::
+popWord() {
+    EDF_ASSERTD( length() >= sizeof(U), "Queue must hold sizeof(U) bytes in order to pop a multi-byte value" );
+    U result = 0;
+    if( slot( head ) + sizeof(U) <= N ) {
+        result = load<U, E>( buffer.data() + slot( head ) );
     }
     else {
-        head = (head+1) % N;
+        std::uint8_t bytes[sizeof(U)] = {};
+        for( std::size_t k = 0; k < sizeof(U); ++k ) {
+            bytes[k] = buffer[slot( advance( head, k ) )];
+        }
+        result = load<U, E>( bytes );
     }
-    return tmp;
+    head = advance( head, sizeof(U) );
+    return result;
 }
 
-/* uint8_t specialized memler functions */
-template<typename T, std::size_t N>
-constexpr std::uint8_t Queue<T,N>::
+/* Asserts once for the whole word, and writes it with a single store unless it wraps */
+template<typename T, std::size_t N, QueueMode M>
+template<typename U, Endian E>
+constexpr void Queue<T, N, M>::
+pushWord( U value ) {
+    EDF_ASSERTD( (maxLength() - length()) >= sizeof(U), "Queue must have room for sizeof(U) bytes in order to push a multi-byte value" );
+    if( slot( tail ) + sizeof(U) <= N ) {
+        store<U, E>( buffer.data() + slot( tail ), value );
+    }
+    else {
+        std::uint8_t bytes[sizeof(U)] = {};
+        store<U, E>( bytes, value );
+        for( std::size_t k = 0; k < sizeof(U); ++k ) {
+            buffer[slot( advance( tail, k ) )] = bytes[k];
+        }
+    }
+    tail = advance( tail, sizeof(U) );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint8_t Queue<T, N, M>::
 pop8be() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop8be() is only available if T is a 'std::uint8_t'");
     return pop();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint16_t Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint16_t Queue<T, N, M>::
 pop16be() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop16be() is only available if T is a 'std::uint8_t'");
-    uint16_t result = static_cast<uint16_t>(static_cast<uint16_t>(pop8be()) << 8);
-    result |= pop8be();
-    return result;
+    return popWord<std::uint16_t, Endian::big>();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint32_t Queue<T,N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint32_t Queue<T, N, M>::
 pop32be() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop32be() is only available if T is a 'std::uint8_t'");
-    uint32_t result = static_cast<uint32_t>(pop16be()) << 16;
-    result |= pop16be();
-    return result;
+    return popWord<std::uint32_t, Endian::big>();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint64_t Queue<T,N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint64_t Queue<T, N, M>::
 pop64be() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop64be() is only available if T is a 'std::uint8_t'");
-    uint64_t result = static_cast<std::uint64_t>(pop32be()) << 32;
-    result |= pop32be();
-    return result;
+    return popWord<std::uint64_t, Endian::big>();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint8_t Queue<T,N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint8_t Queue<T, N, M>::
 pop8le() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop8le() is only available if T is a 'std::uint8_t'");
     return pop();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint16_t Queue<T, N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint16_t Queue<T, N, M>::
 pop16le() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop16le() is only available if T is a 'std::uint8_t'");
-    uint16_t result = pop8le();
-    result |= pop8le() << 8;
-    return result;
+    return popWord<std::uint16_t, Endian::little>();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint32_t Queue<T,N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint32_t Queue<T, N, M>::
 pop32le() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop32le() is only available if T is a 'std::uint8_t'");
-    uint32_t result = pop16le();
-    result |= static_cast<uint32_t>(pop16le()) << 16;
-    return result;
+    return popWord<std::uint32_t, Endian::little>();
 }
 
-template<typename T, std::size_t N>
-constexpr std::uint64_t Queue<T,N>::
+template<typename T, std::size_t N, QueueMode M>
+constexpr std::uint64_t Queue<T, N, M>::
 pop64le() {
     static_assert( std::is_same_v<T, std::uint8_t>, "pop64le() is only available if T is a 'std::uint8_t'");
-    uint64_t result = pop32le();
-    result |= static_cast<std::uint64_t>(pop32le()) << 32;
-    return result;
+    return popWord<std::uint64_t, Endian::little>();
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push8be( std::uint8_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push8be() is only available if T is a 'std::uint8_t'");
+    push( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push16be( std::uint16_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push16be() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint16_t, Endian::big>( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push32be( std::uint32_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push32be() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint32_t, Endian::big>( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push64be( std::uint64_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push64be() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint64_t, Endian::big>( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push8le( std::uint8_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push8le() is only available if T is a 'std::uint8_t'");
+    push( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push16le( std::uint16_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push16le() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint16_t, Endian::little>( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push32le( std::uint32_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push32le() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint32_t, Endian::little>( value );
+}
+
+template<typename T, std::size_t N, QueueMode M>
+constexpr void Queue<T, N, M>::
+push64le( std::uint64_t value ) {
+    static_assert( std::is_same_v<T, std::uint8_t>, "push64le() is only available if T is a 'std::uint8_t'");
+    pushWord<std::uint64_t, Endian::little>( value );
 }
 
 } /* EDF */
\ No newline at end of file
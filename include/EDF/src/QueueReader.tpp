@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/QueueReader.hpp"
+
+namespace EDF {
+
+template<std::size_t N, QueueMode M>
+constexpr impl::SplitBytes<const std::uint8_t> QueueReader<N, M>::
+cursor() const {
+    return impl::SplitBytes<const std::uint8_t>( spans[0].data(), spans[0].length(), spans[1].data(), offset );
+}
+
+/* Checks the whole frame is available once, then decodes every field without further checks */
+template<std::size_t N, QueueMode M>
+template<typename L>
+constexpr bool QueueReader<N, M>::
+read( typename L::Type& value ) {
+    if( available() < L::SIZE ) {
+        return false;
+    }
+    auto bytes = cursor();
+    L::decode( bytes, value );
+    offset = bytes.position();
+    return true;
+}
+
+template<std::size_t N, QueueMode M>
+template<typename T, Endian E>
+constexpr T QueueReader<N, M>::
+read() {
+    EDF_ASSERTD( available() >= sizeof(T), "QueueReader must have sizeof(T) bytes available in order to use read()" );
+    auto bytes = cursor();
+    T value = bytes.template load<T, E>();
+    offset = bytes.position();
+    return value;
+}
+
+template<std::size_t N, QueueMode M>
+constexpr void QueueReader<N, M>::
+skip( std::size_t count ) {
+    EDF_ASSERTD( available() >= count, "QueueReader must have count bytes available in order to use skip()" );
+    offset += count;
+}
+
+/* Removes every byte read so far from the queue */
+template<std::size_t N, QueueMode M>
+constexpr void QueueReader<N, M>::
+commit() {
+    queue.commitPop( offset );
+    offset = 0;
+    refresh();
+}
+
+} /* EDF */
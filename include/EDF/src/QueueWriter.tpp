@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/QueueWriter.hpp"
+
+namespace EDF {
+
+template<std::size_t N, QueueMode M>
+constexpr impl::SplitBytes<std::uint8_t> QueueWriter<N, M>::
+cursor() const {
+    return impl::SplitBytes<std::uint8_t>( spans[0].data(), spans[0].length(), spans[1].data(), offset );
+}
+
+/* Checks the whole frame fits once, then encodes every field without further checks */
+template<std::size_t N, QueueMode M>
+template<typename L>
+constexpr bool QueueWriter<N, M>::
+write( const typename L::Type& value ) {
+    if( available() < L::SIZE ) {
+        return false;
+    }
+    auto bytes = cursor();
+    L::encode( bytes, value );
+    offset = bytes.position();
+    return true;
+}
+
+template<std::size_t N, QueueMode M>
+template<typename T, Endian E>
+constexpr void QueueWriter<N, M>::
+write( const T& value ) {
+    EDF_ASSERTD( available() >= sizeof(T), "QueueWriter must have room for sizeof(T) bytes in order to use write()" );
+    auto bytes = cursor();
+    bytes.template store<T, E>( value );
+    offset = bytes.position();
+}
+
+/* Adds every byte written so far to the end of the queue */
+template<std::size_t N, QueueMode M>
+constexpr void QueueWriter<N, M>::
+commit() {
+    queue.commitPush( offset );
+    offset = 0;
+    refresh();
+}
+
+} /* EDF */
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/RadixHeap.hpp"
+#include "EDF/Assert.hpp"
+#include "EDF/Math.hpp"
+
+#include <utility>
+
+namespace EDF {
+
+// Bucket 0 holds keys equal to last, bucket b holds keys whose highest bit that differs from last is bit b-1
+template<typename T, std::size_t N, typename KeyOf>
+constexpr std::size_t RadixHeap<T, N, KeyOf>::
+bucketOf( Key key ) const {
+    return bitWidth( static_cast<Key>(key ^ last) );
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr void RadixHeap<T, N, KeyOf>::
+link( Index slot ) {
+    const std::size_t bucket = bucketOf( keyOf( values[slot] ) );
+    next[slot] = buckets[bucket];
+    buckets[bucket] = slot;
+    if( bucket != 0 ) {
+        nonEmpty |= std::uint64_t(1) << (bucket - 1);
+    }
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr typename RadixHeap<T, N, KeyOf>::Index RadixHeap<T, N, KeyOf>::
+acquireSlot() {
+    if( freeSlot != NONE ) {
+        const Index slot = freeSlot;
+        freeSlot = next[slot];
+        return slot;
+    }
+    return unusedSlot++;
+}
+
+/*
+ * Only called by pop() when bucket 0 is empty. The smallest key is in the lowest non-empty bucket, it becomes the new last,
+ * and every element of that bucket now differs from last at a lower bit, so moves to a lower bucket.
+ */
+template<typename T, std::size_t N, typename KeyOf>
+constexpr void RadixHeap<T, N, KeyOf>::
+refill() {
+    const std::size_t bucket = countTrailingZeros( nonEmpty ) + 1;
+    Index slot = buckets[bucket];
+    Key smallest = keyOf( values[slot] );
+    for( Index k = next[slot]; k != NONE; k = next[k] ) {
+        const Key key = keyOf( values[k] );
+        if( key < smallest ) {
+            smallest = key;
+        }
+    }
+    last = smallest;
+    buckets[bucket] = NONE;
+    nonEmpty &= ~(std::uint64_t(1) << (bucket - 1));
+    while( slot != NONE ) {
+        const Index following = next[slot];
+        link( slot );
+        slot = following;
+    }
+}
+
+/*
+ * Doesn't refill bucket 0, the smallest key only becomes last once it's popped.
+ * Otherwise a key between the previous last and the smallest key could no longer be pushed.
+ */
+template<typename T, std::size_t N, typename KeyOf>
+constexpr const T& RadixHeap<T, N, KeyOf>::
+peek() const {
+    EDF_ASSERTD( !isEmpty(), "RadixHeap must not be empty in order to use peek()" );
+    if( buckets[0] != NONE ) {
+        return values[buckets[0]];
+    }
+    Index best = buckets[countTrailingZeros( nonEmpty ) + 1];
+    for( Index k = next[best]; k != NONE; k = next[k] ) {
+        if( keyOf( values[k] ) < keyOf( values[best] ) ) {
+            best = k;
+        }
+    }
+    return values[best];
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr void RadixHeap<T, N, KeyOf>::
+push( const T& value ) {
+    EDF_ASSERTD( !isFull(), "RadixHeap must not be full in order to use push()" );
+    EDF_ASSERTD( keyOf( value ) >= last, "RadixHeap keys must not be less than the last key popped" );
+    const Index slot = acquireSlot();
+    new (&values[slot]) T(value);
+    link( slot );
+    ++n;
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr void RadixHeap<T, N, KeyOf>::
+push( T&& value ) {
+    EDF_ASSERTD( !isFull(), "RadixHeap must not be full in order to use push()" );
+    EDF_ASSERTD( keyOf( value ) >= last, "RadixHeap keys must not be less than the last key popped" );
+    const Index slot = acquireSlot();
+    new (&values[slot]) T(std::move(value));
+    link( slot );
+    ++n;
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+template<typename... Args>
+constexpr T& RadixHeap<T, N, KeyOf>::
+emplace( Args&&... args ) {
+    EDF_ASSERTD( !isFull(), "RadixHeap must not be full in order to use emplace()" );
+    const Index slot = acquireSlot();
+    T& value = *new (&values[slot]) T(std::forward<Args>(args)...);
+    EDF_ASSERTD( keyOf( value ) >= last, "RadixHeap keys must not be less than the last key popped" );
+    link( slot );
+    ++n;
+    return value;
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr T RadixHeap<T, N, KeyOf>::
+pop() {
+    EDF_ASSERTD( !isEmpty(), "RadixHeap must not be empty in order to use pop()" );
+    if( buckets[0] == NONE ) {
+        refill();
+    }
+    const Index slot = buckets[0];
+    buckets[0] = next[slot];
+    next[slot] = freeSlot;
+    freeSlot = slot;
+    --n;
+    T value( std::move(values[slot]) );
+    std::destroy_at( &values[slot] );
+    return value;
+}
+
+template<typename T, std::size_t N, typename KeyOf>
+constexpr void RadixHeap<T, N, KeyOf>::
+clear() {
+    if constexpr( !std::is_trivially_destructible_v<T> ) {
+        for( std::size_t bucket = 0; bucket < BUCKETS; ++bucket ) {
+            for( Index slot = buckets[bucket]; slot != NONE; slot = next[slot] ) {
+                std::destroy_at( &values[slot] );
+            }
+        }
+    }
+    buckets.fill( NONE );
+    nonEmpty = 0;
+    freeSlot = NONE;
+    unusedSlot = 0;
+    n = 0;
+    last = 0;
+}
+
+} /* EDF */
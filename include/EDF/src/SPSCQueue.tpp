@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/SPSCQueue.hpp"
+#include "EDF/Math.hpp"
+
+#include <utility>
+
+namespace EDF {
+
+template<typename T, std::size_t N>
+constexpr std::size_t SPSCQueue<T, N>::
+next( std::size_t index ) {
+    if constexpr( isPow2( N ) ) {
+        return (index+1) & WRAP;
+    }
+    return (index+1) % N;
+}
+
+template<typename T, std::size_t N>
+std::size_t SPSCQueue<T, N>::
+length() const {
+    const std::size_t h = head.load( std::memory_order_acquire );
+    const std::size_t t = tail.load( std::memory_order_acquire );
+    if constexpr( isPow2( N ) ) {
+        return (t - h) & WRAP;
+    }
+    return (t >= h) ? (t - h) : (N - h + t);
+}
+
+/*
+ * Producer: the element is written before tail is published with release ordering, so the
+ * consumer's acquire load of tail guarantees it sees the fully written element.
+ */
+template<typename T, std::size_t N>
+void SPSCQueue<T, N>::
+push( const T& value ) {
+    const std::size_t t = tail.load( std::memory_order_relaxed );
+    const std::size_t nextTail = next( t );
+    EDF_ASSERTD( nextTail != head.load( std::memory_order_acquire ), "SPSCQueue must not be full in order to use push()" );
+    buffer[t] = value;
+    tail.store( nextTail, std::memory_order_release );
+}
+
+template<typename T, std::size_t N>
+void SPSCQueue<T, N>::
+push( T&& value ) {
+    const std::size_t t = tail.load( std::memory_order_relaxed );
+    const std::size_t nextTail = next( t );
+    EDF_ASSERTD( nextTail != head.load( std::memory_order_acquire ), "SPSCQueue must not be full in order to use push()" );
+    buffer[t] = std::move(value);
+    tail.store( nextTail, std::memory_order_release );
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+void SPSCQueue<T, N>::
+emplace( Args&&... args ) {
+    const std::size_t t = tail.load( std::memory_order_relaxed );
+    const std::size_t nextTail = next( t );
+    EDF_ASSERTD( nextTail != head.load( std::memory_order_acquire ), "SPSCQueue must not be full in order to use emplace()" );
+    new (&buffer[t]) T(std::forward<Args>(args)...);
+    tail.store( nextTail, std::memory_order_release );
+}
+
+/*
+ * Consumer: the element is moved out before head is published with release ordering, so the
+ * producer can't overwrite the slot until the consumer is done with it.
+ */
+template<typename T, std::size_t N>
+T SPSCQueue<T, N>::
+pop() {
+    const std::size_t h = head.load( std::memory_order_relaxed );
+    EDF_ASSERTD( h != tail.load( std::memory_order_acquire ), "SPSCQueue must not be empty in order to use pop()" );
+    T tmp = std::move(buffer[h]);
+    head.store( next( h ), std::memory_order_release );
+    return tmp;
+}
+
+} /* EDF */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Scheduler.hpp"
+#include "EDF/Assert.hpp"
+
+namespace EDF {
+
+// Bumping the generation makes every JobId and Ready entry that still refers to the slot stale
+template<std::size_t N, typename Clock>
+constexpr void Scheduler<N, Clock>::
+release( std::size_t slot ) {
+    jobs[slot].state = State::free;
+    ++jobs[slot].generation;
+    jobs[slot].handle = freeSlot;
+    freeSlot = slot;
+    --nJobs;
+}
+
+template<std::size_t N, typename Clock>
+typename Scheduler<N, Clock>::JobId Scheduler<N, Clock>::
+schedule( Callback callback, void* context, Tick delay, Tick period ) {
+    EDF_ASSERTD( callback != nullptr, "callback must not be null" );
+    EDF_ASSERTD( difference( delay, 0 ) >= 0 && difference( period, 0 ) >= 0, "delay and period must be less than half the range of Tick" );
+    std::size_t slot;
+    if( freeSlot != N ) {
+        slot = freeSlot;
+        freeSlot = jobs[slot].handle;
+    }
+    else if( unusedSlot != N ) {
+        slot = unusedSlot++;
+    }
+    else {
+        return INVALID_JOB;
+    }
+    Job& job = jobs[slot];
+    job.callback = callback;
+    job.context = context;
+    // Counting from the clock inside a callback could put the job before the now being dispatched,
+    // so runUntilIdle() would keep finding it due and never return
+    job.due = static_cast<Tick>((dispatching ? dispatchNow : Clock::now()) + delay);
+    job.period = period;
+    job.handle = deadlines.push( Deadline{ job.due, slot } );
+    job.state = State::pending;
+    ++nJobs;
+    return JobId{ slot, job.generation };
+}
+
+template<std::size_t N, typename Clock>
+constexpr bool Scheduler<N, Clock>::
+cancel( JobId id ) {
+    if( !owns( id ) ) {
+        return false;
+    }
+    if( jobs[id.slot].state == State::pending ) {
+        deadlines.erase( jobs[id.slot].handle );
+    }
+    // A ready job's queue entry is skipped once the generation changes
+    release( id.slot );
+    return true;
+}
+
+/*
+ * Periodic jobs are rescheduled before their callback runs, so the callback may cancel itself.
+ * The next deadline is the previous one plus the period, so dispatch jitter doesn't accumulate into drift.
+ * A job that fell more than a whole period behind skips the missed runs instead of running back to back.
+ */
+template<std::size_t N, typename Clock>
+constexpr void Scheduler<N, Clock>::
+dispatch( std::size_t slot, Tick now ) {
+    Job& job = jobs[slot];
+    const auto lateness = static_cast<Tick>(now - job.due);
+    if( lateness > lateTolerance ) {
+        ++nLate;
+    }
+    if( lateness > worstLateness ) {
+        worstLateness = lateness;
+    }
+
+    const Callback callback = job.callback;
+    void* const context = job.context;
+    if( job.period != 0 ) {
+        job.due = static_cast<Tick>(job.due + job.period);
+        if( difference( job.due, now ) <= 0 ) {
+            job.due = static_cast<Tick>(job.due + (static_cast<Tick>(now - job.due) / job.period + 1) * job.period);
+        }
+        job.handle = deadlines.push( Deadline{ job.due, slot } );
+        job.state = State::pending;
+    }
+    else {
+        release( slot );
+    }
+    callback( context );
+}
+
+/*
+ * Due jobs are moved from the heap to the ready queue first, then the queue is drained.
+ * Jobs scheduled or cancelled by callbacks only change the heap, or make queue entries stale,
+ * so the queue never holds more than N entries.
+ */
+template<std::size_t N, typename Clock>
+std::size_t Scheduler<N, Clock>::
+runUntilIdle( Tick now ) {
+    // Saved and restored in case a callback calls runUntilIdle() itself
+    const bool wasDispatching = dispatching;
+    const Tick previousNow = dispatchNow;
+    dispatching = true;
+    dispatchNow = now;
+
+    std::size_t nDispatched = 0;
+    while( true ) {
+        while( !deadlines.isEmpty() && (difference( deadlines.peek().due, now ) <= 0) ) {
+            const std::size_t slot = deadlines.pop().slot;
+            jobs[slot].state = State::ready;
+            ready.push( Ready{ slot, jobs[slot].generation } );
+        }
+        if( ready.isEmpty() ) {
+            dispatching = wasDispatching;
+            dispatchNow = previousNow;
+            return nDispatched;
+        }
+        while( !ready.isEmpty() ) {
+            const Ready entry = ready.pop();
+            const Job& job = jobs[entry.slot];
+            if( (job.generation != entry.generation) || (job.state != State::ready) ) {
+                continue;
+            }
+            dispatch( entry.slot, now );
+            ++nDispatched;
+        }
+    }
+}
+
+template<std::size_t N, typename Clock>
+constexpr typename Scheduler<N, Clock>::Tick Scheduler<N, Clock>::
+ticksUntilNext( Tick now ) const {
+    EDF_ASSERTD( hasPending(), "Scheduler must have a pending job in order to use ticksUntilNext()" );
+    const SignedTick remaining = difference( deadlines.peek().due, now );
+    return (remaining > 0) ? static_cast<Tick>(remaining) : Tick(0);
+}
+
+} /* EDF */
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/SmallVector.hpp"
+
+namespace EDF {
+
+// Moves the elements to a buffer of newLimit elements from the allocator
+template<typename T, std::size_t N, typename Alloc>
+constexpr void SmallVector<T, N, Alloc>::
+reallocate( std::size_t newLimit ) {
+    EDF_ASSERTD(newLimit <= maxLength(), "allocator must be able to provide newLimit elements");
+    T* fresh = Traits::allocate( allocator, newLimit );
+    std::uninitialized_move( begin(), end(), fresh );
+    std::destroy( begin(), end() );
+    if( !isInline() ) {
+        Traits::deallocate( allocator, elements, limit );
+    }
+    elements = fresh;
+    limit = newLimit;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr void SmallVector<T, N, Alloc>::
+release() {
+    std::destroy( begin(), end() );
+    if( !isInline() ) {
+        Traits::deallocate( allocator, elements, limit );
+    }
+    elements = inlineElements;
+    n = 0;
+    limit = N;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+template<typename... I>
+constexpr SmallVector<T, N, Alloc>::
+SmallVector( I... iList ) : elements(inlineElements), n(0), limit(N), allocator{}, unused{} {
+    static_assert( (impl::IsCopyListInitializable<T, I>::value && ...), "every initializer must convert to T implicitly, without narrowing" );
+    growFor( sizeof...(I) );
+    ( (new (data() + n) T{std::move(iList)}, ++n), ... );
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr SmallVector<T, N, Alloc>::
+SmallVector( const SmallVector& other ) :
+    elements(inlineElements), n(0), limit(N),
+    allocator(Traits::select_on_container_copy_construction( other.allocator )), unused{}
+{
+    reserve( other.length() );
+    std::uninitialized_copy( other.begin(), other.end(), data() );
+    n = other.length();
+}
+
+// An allocated buffer is taken over, inline elements have to be moved one by one
+template<typename T, std::size_t N, typename Alloc>
+constexpr SmallVector<T, N, Alloc>::
+SmallVector( SmallVector&& other ) : elements(inlineElements), n(0), limit(N), allocator(std::move(other.allocator)), unused{} {
+    if( other.isInline() ) {
+        std::uninitialized_move( other.begin(), other.end(), data() );
+        n = other.length();
+        other.clear();
+        return;
+    }
+    elements = other.elements;
+    n = other.n;
+    limit = other.limit;
+    other.elements = other.inlineElements;
+    other.n = 0;
+    other.limit = N;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr SmallVector<T, N, Alloc>& SmallVector<T, N, Alloc>::
+operator=( const SmallVector& other ) {
+    if( this != &other ) {
+        clear();
+        reserve( other.length() );
+        std::uninitialized_copy( other.begin(), other.end(), data() );
+        n = other.length();
+    }
+    return *this;
+}
+
+// The allocator is kept, other's buffer can only be taken over if this allocator is able to free it
+template<typename T, std::size_t N, typename Alloc>
+constexpr SmallVector<T, N, Alloc>& SmallVector<T, N, Alloc>::
+operator=( SmallVector&& other ) {
+    if( this == &other ) {
+        return *this;
+    }
+    if( !other.isInline() && (Traits::is_always_equal::value || (allocator == other.allocator)) ) {
+        release();
+        elements = other.elements;
+        n = other.n;
+        limit = other.limit;
+        other.elements = other.inlineElements;
+        other.n = 0;
+        other.limit = N;
+        return *this;
+    }
+    clear();
+    reserve( other.length() );
+    std::uninitialized_move( other.begin(), other.end(), data() );
+    n = other.length();
+    other.clear();
+    return *this;
+}
+
+/*
+ * value may refer to an element of this vector, which moves when the buffer grows or the tail shifts.
+ * It's copied first whenever that can happen.
+ */
+template<typename T, std::size_t N, typename Alloc>
+constexpr typename SmallVector<T, N, Alloc>::Iterator SmallVector<T, N, Alloc>::
+insert( ConstIterator pos, std::size_t count, const T& value ) {
+    EDF_ASSERTD(pos >= begin(), "position must be valid");
+    EDF_ASSERTD(pos <= end(), "position must be valid");
+
+    const auto index = static_cast<std::size_t>(pos - begin());
+    const T copy( value );
+    growFor( n + count );
+    Iterator position = begin() + index;
+    impl::openGap( position, end(), count );
+    std::uninitialized_fill_n( position, count, copy );
+    n += count;
+    return position;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr typename SmallVector<T, N, Alloc>::Iterator SmallVector<T, N, Alloc>::
+insert( ConstIterator pos, std::initializer_list<T> iList ) {
+    EDF_ASSERTD(pos >= begin(), "position must be valid");
+    EDF_ASSERTD(pos <= end(), "position must be valid");
+
+    const auto index = static_cast<std::size_t>(pos - begin());
+    growFor( n + iList.size() );
+    Iterator position = begin() + index;
+    impl::openGap( position, end(), iList.size() );
+    std::uninitialized_copy( iList.begin(), iList.end(), position );
+    n += iList.size();
+    return position;
+}
+
+// Constructing at the end with room to spare is the common case, and needs no temporary
+template<typename T, std::size_t N, typename Alloc>
+template<typename... Args>
+constexpr typename SmallVector<T, N, Alloc>::Iterator SmallVector<T, N, Alloc>::
+emplace( ConstIterator pos, Args&&... args ) {
+    EDF_ASSERTD(pos >= begin(), "position must be valid");
+    EDF_ASSERTD(pos <= end(), "position must be valid");
+
+    const auto index = static_cast<std::size_t>(pos - begin());
+    if( (index == n) && (n < limit) ) {
+        new (data() + n) T(std::forward<Args>(args)...);
+        ++n;
+        return begin() + index;
+    }
+    // args may refer to an element that is about to move
+    T value( std::forward<Args>(args)... );
+    growFor( n + 1 );
+    Iterator position = begin() + index;
+    impl::openGap( position, end(), 1 );
+    new (position) T(std::move(value));
+    ++n;
+    return position;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr typename SmallVector<T, N, Alloc>::Iterator SmallVector<T, N, Alloc>::
+erase( ConstIterator first, ConstIterator last ) {
+    EDF_ASSERTD(first >= begin(), "first position must be valid");
+    EDF_ASSERTD(first <= last, "first position must be less than last");
+    EDF_ASSERTD(last  <= end(), "last position must be valid");
+
+    Iterator s = begin() + (first - begin());
+    Iterator e = begin() + (last - begin());
+    impl::shift( e, s, static_cast<std::size_t>(end() - e) );
+
+    const auto count = static_cast<std::size_t>(e - s);
+    std::destroy( end() - count, end() );
+    n -= count;
+    return s;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr T SmallVector<T, N, Alloc>::
+popBack() {
+    EDF_ASSERTD(!isEmpty(), "SmallVector must not be empty in order to use popBack()");
+    T v(std::move(back()));
+    std::destroy_at( &back() );
+    --n;
+    return v;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+template<typename InputIt>
+constexpr void SmallVector<T, N, Alloc>::
+append( InputIt first, InputIt last ) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr( std::is_base_of_v<std::forward_iterator_tag, Category> ) {
+        const auto count = static_cast<std::size_t>(std::distance( first, last ));
+        growFor( n + count );
+        std::uninitialized_copy( first, last, end() );
+        n += count;
+    }
+    else {
+        for( ; first != last; ++first ) {
+            emplaceBack( *first );
+        }
+    }
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr void SmallVector<T, N, Alloc>::
+resize( std::size_t count ) {
+    if( count < length() ) {
+        std::destroy( begin() + count, end() );
+    }
+    else {
+        growFor( count );
+        std::uninitialized_value_construct( end(), begin() + count );
+    }
+    n = count;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr void SmallVector<T, N, Alloc>::
+resize( std::size_t count, const T& value ) {
+    if( count < length() ) {
+        std::destroy( begin() + count, end() );
+    }
+    else {
+        const T copy( value );
+        growFor( count );
+        std::uninitialized_fill( end(), begin() + count, copy );
+    }
+    n = count;
+}
+
+template<typename T, std::size_t N, typename Alloc>
+constexpr void SmallVector<T, N, Alloc>::
+commit( std::size_t count ) {
+    static_assert( std::is_trivially_copyable_v<T>, "commit() requires a trivially copyable T" );
+    EDF_ASSERTD(count <= limit - n, "count must fit in the spare capacity");
+    n += count;
+}
+
+} /* EDF */
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "EDF/Stack.hpp"
+
+namespace EDF {
+
+/* Stack */
+
+template<typename T, std::size_t N>
+constexpr void Stack<T, N>::
+popN( T* values, std::size_t count ) {
+    EDF_ASSERTD(count <= length(), "must have count elements to pop");
+    std::move( buffer.rbegin(), buffer.rbegin() + count, values );
+    popN( count );
+}
+
+template<typename T, std::size_t N>
+constexpr void Stack<T, N>::
+popN( std::size_t count ) {
+    EDF_ASSERTD(count <= length(), "must have count elements to pop");
+    buffer.erase( buffer.end() - count, buffer.end() );
+}
+
+/* AtomicStack */
+
+template<typename T, std::size_t N>
+AtomicStack<T, N>::
+~AtomicStack() {
+    if constexpr( !std::is_trivially_destructible_v<T> ) {
+        for( Index index = lists.first( top ); index != Lists::NONE; index = lists.following( index ) ) {
+            std::destroy_at( element( index ) );
+        }
+    }
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+bool AtomicStack<T, N>::
+emplace( Args&&... args ) {
+    const Index index = lists.allocate();
+    if( index == Lists::NONE ) {
+        return false;
+    }
+    new (element( index )) T(std::forward<Args>(args)...);
+    // Counted before it's visible and uncounted after it's gone, so length() never drops below 0
+    n.fetch_add( 1, std::memory_order_relaxed );
+    lists.give( top, index );
+    return true;
+}
+
+template<typename T, std::size_t N>
+bool AtomicStack<T, N>::
+pop( T& value ) {
+    const Index index = lists.take( top );
+    if( index == Lists::NONE ) {
+        return false;
+    }
+    value = std::move(*element( index ));
+    std::destroy_at( element( index ) );
+    n.fetch_sub( 1, std::memory_order_relaxed );
+    lists.deallocate( index );
+    return true;
+}
+
+} /* EDF */
@@ -11,6 +11,114 @@
 
 namespace EDF {
 
+namespace impl {
+/*
+ * Trivially copyable elements are relocated with a single memmove, others are moved one by one
+ * in the direction that doesn't overwrite elements before they're moved.
+ */
+template<typename T, std::size_t N, typename... I>
+constexpr VectorStorage<T, N> makeListStorage( I&&... iList ) {
+    // Only literal types can be constructed in a constant expression, and the elements past iList need a default
+    if constexpr( std::is_trivially_destructible_v<T> && ((sizeof...(I) == N) || std::is_default_constructible_v<T>) ) {
+        if( __builtin_is_constant_evaluated() ) {
+            return VectorStorage<T, N>( std::in_place, std::forward<I>(iList)... );
+        }
+    }
+    return {};
+}
+
+template<typename T>
+constexpr void shift( T* from, T* to, std::size_t count ) {
+    if( (count == 0) || (from == to) ) {
+        return;
+    }
+    if constexpr( std::is_trivially_copyable_v<T> ) {
+        if( !__builtin_is_constant_evaluated() ) {
+            std::memmove( to, from, count * sizeof(T) );
+            return;
+        }
+    }
+    if( to < from ) {
+        std::move( from, from + count, to );
+    }
+    else {
+        std::move_backward( from, from + count, to + count );
+    }
+}
+
+template<typename T>
+constexpr void openGap( T* position, T* last, std::size_t count ) {
+    const auto tail = static_cast<std::size_t>(last - position);
+    if constexpr( std::is_trivially_copyable_v<T> ) {
+        shift( position, position + count, tail );
+    }
+    else {
+        // The last k elements land past the end, where there are no objects yet
+        const std::size_t k = EDF::min( count, tail );
+        std::uninitialized_move( last - k, last, last - k + count );
+        std::move_backward( position, last - k, last - k + count );
+        std::destroy( position, position + k );
+    }
+}
+} /* impl */
+
+template<typename T, std::size_t N>
+template<typename... I>
+constexpr Vector<T, N>::
+Vector( I... iList ) : storage( impl::makeListStorage<T, N>( std::move(iList)... ) ) {
+    static_assert( sizeof...(I) <= N, "Vector must be able to hold every initializer" );
+    // Same rules as brace initializing an array of T: no narrowing, and no explicit constructors
+    static_assert( (impl::IsCopyListInitializable<T, I>::value && ...), "every initializer must convert to T implicitly, without narrowing" );
+    if( storage.n == 0 ) {
+        ( (new (data() + storage.n) T{std::move(iList)}, ++storage.n), ... );
+    }
+}
+
+template<typename T, std::size_t N>
+constexpr Vector<T, N>::
+Vector( const Vector& other ) : storage{} {
+    std::uninitialized_copy( other.begin(), other.end(), data() );
+    storage.n = other.length();
+}
+
+template<typename T, std::size_t N>
+constexpr Vector<T, N>::
+Vector( Vector&& other ) : storage{} {
+    std::uninitialized_move( other.begin(), other.end(), data() );
+    storage.n = other.length();
+}
+
+template<typename T, std::size_t N>
+constexpr Vector<T, N>& Vector<T, N>::
+operator=( const Vector& other ) {
+    if( this != &other ) {
+        clear();
+        std::uninitialized_copy( other.begin(), other.end(), data() );
+        storage.n = other.length();
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N>
+constexpr Vector<T, N>& Vector<T, N>::
+operator=( Vector&& other ) {
+    if( this != &other ) {
+        clear();
+        std::uninitialized_move( other.begin(), other.end(), data() );
+        storage.n = other.length();
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N>
+constexpr void Vector<T, N>::
+clear() {
+    if constexpr( !std::is_trivially_destructible_v<T> ) {
+        std::destroy( begin(), end() );
+    }
+    storage.n = 0;
+}
+
 template<typename T, std::size_t N>
 constexpr typename Vector<T, N>::Iterator Vector<T, N>::
 insert( ConstIterator pos, T&& value ) {
@@ -19,10 +127,10 @@ insert( ConstIterator pos, T&& value ) {
     EDF_ASSERTD(!isFull(), "must have enough space for new element");
 
     Iterator position = begin() + (pos - begin());
-    std::move_backward( position, end(), end() + 1 );
-    *position = std::move(value);   // insert new element at pos
-    ++n;
-    return position;                // iterator pointing to the inserted value
+    impl::openGap( position, end(), 1 );
+    new (position) T(std::move(value)); // insert new element at pos
+    ++storage.n;
+    return position;                    // iterator pointing to the inserted value
 }
 
 template<typename T, std::size_t N>
@@ -33,9 +141,9 @@ insert( ConstIterator pos, std::size_t count, const T& value ) {
     EDF_ASSERTD((end() + count) <= (begin() + maxLength()), "new values must be able to fit");
 
     Iterator position = begin() + (pos - begin());
-    std::move_backward( position, end(), end() + count );
-    std::fill_n( position, count, value );
-    n += count;
+    impl::openGap( position, end(), count );
+    std::uninitialized_fill_n( position, count, value );
+    storage.n += count;
     return position;
 }
 
@@ -47,9 +155,9 @@ insert( ConstIterator pos, std::initializer_list<T> iList ) {
     EDF_ASSERTD((end() + iList.size()) <= (begin() + maxLength()), "new values must be able to fit");
 
     Iterator position = begin() + (pos - begin());
-    std::move_backward( position, end(), end() + iList.size() );
-    std::copy(iList.begin(), iList.end(), position);
-    n += iList.size();
+    impl::openGap( position, end(), iList.size() );
+    std::uninitialized_copy( iList.begin(), iList.end(), position );
+    storage.n += iList.size();
     return position;
 }
 
@@ -62,12 +170,23 @@ emplace( ConstIterator pos, Args&&... args ) {
     EDF_ASSERTD(!isFull(), "must have enough space for new element");
 
     Iterator position = begin() + (pos - begin());
-    std::move_backward( position, end(), end() + 1 );
+    impl::openGap( position, end(), 1 );
     new (position) T(std::forward<Args>(args)...);
-    ++n;
+    ++storage.n;
     return position;
 }
 
+template<typename T, std::size_t N>
+template<typename... Args>
+constexpr T& Vector<T, N>::
+emplaceBack( Args&&... args ) {
+    EDF_ASSERTD(!isFull(), "must have enough space for new element");
+
+    T* element = new (end()) T(std::forward<Args>(args)...);
+    ++storage.n;
+    return *element;
+}
+
 template<typename T, std::size_t N>
 constexpr typename Vector<T, N>::Iterator Vector<T, N>::
 erase( ConstIterator pos ) {
@@ -75,9 +194,9 @@ erase( ConstIterator pos ) {
     EDF_ASSERTD(pos < end(), "position must be valid");
 
     Iterator position = begin() + (pos - begin());
-    position->~T(); // destruct element being erase
-    std::move_backward( position + 1, end(), end() - 1 );
-    --n;            // decrement length by 1
+    impl::shift( position + 1, position, static_cast<std::size_t>(end() - (position + 1)) );
+    std::destroy_at( end() - 1 );   // the last element was moved from
+    --storage.n;                    // decrement length by 1
     return position;
 }
 
@@ -94,15 +213,85 @@ erase( ConstIterator first, ConstIterator last ) {
     Iterator s = begin() + (first - begin());
     Iterator e = begin() + (last - begin());
 
-    // destruct elements to be erased
-    std::destroy(s, e);
+    // shift elements to the 'left', over the elements being erased
+    impl::shift( e, s, static_cast<std::size_t>(end() - e) );
 
-    // shift elements to the 'left'
-    std::move_backward( e, end(), s + (end() - last) );
+    // destruct the elements left moved from at the end
+    const auto count = static_cast<std::size_t>(e - s);
+    std::destroy( end() - count, end() );
 
     // remove number of elements from container
-    n -= static_cast<std::size_t>(e - s);
+    storage.n -= count;
     return s;
 }
 
+template<typename T, std::size_t N>
+constexpr T Vector<T, N>::
+popBack() {
+    EDF_ASSERTD(!isEmpty(), "Vector must not be empty in order to use popBack()");
+    T v(std::move(back()));
+    std::destroy_at( &back() );
+    --storage.n;
+    return v;
+}
+
+template<typename T, std::size_t N>
+template<typename InputIt>
+constexpr void Vector<T, N>::
+append( InputIt first, InputIt last ) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr( std::is_base_of_v<std::forward_iterator_tag, Category> ) {
+        const auto count = static_cast<std::size_t>(std::distance( first, last ));
+        EDF_ASSERTD(count <= maxLength() - length(), "new values must be able to fit");
+        std::uninitialized_copy( first, last, end() );
+        storage.n += count;
+    }
+    else {
+        // The length isn't known up front, check for room one element at a time
+        for( ; first != last; ++first ) {
+            EDF_ASSERTD(!isFull(), "new values must be able to fit");
+            new (end()) T(*first);
+            ++storage.n;
+        }
+    }
+}
+
+template<typename T, std::size_t N>
+constexpr void Vector<T, N>::
+resize( std::size_t count ) {
+    EDF_ASSERTD(count <= maxLength(), "count must fit in the vector");
+    if( count < length() ) {
+        std::destroy( begin() + count, end() );
+    }
+    else {
+        std::uninitialized_value_construct( end(), begin() + count );
+    }
+    storage.n = count;
+}
+
+template<typename T, std::size_t N>
+constexpr void Vector<T, N>::
+resize( std::size_t count, const T& value ) {
+    EDF_ASSERTD(count <= maxLength(), "count must fit in the vector");
+    if( count < length() ) {
+        std::destroy( begin() + count, end() );
+    }
+    else {
+        std::uninitialized_fill( end(), begin() + count, value );
+    }
+    storage.n = count;
+}
+
+/*
+ * The slots handed out by spareCapacity() are raw storage, writing to them is only enough to
+ * create the elements when T is trivially copyable.
+ */
+template<typename T, std::size_t N>
+constexpr void Vector<T, N>::
+commit( std::size_t count ) {
+    static_assert( std::is_trivially_copyable_v<T>, "commit() requires a trivially copyable T" );
+    EDF_ASSERTD(count <= maxLength() - length(), "count must fit in the spare capacity");
+    storage.n += count;
+}
+
 } /* EDF */
\ No newline at end of file
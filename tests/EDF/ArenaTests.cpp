@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Arena.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+class Counted {
+private:
+    int variable;
+public:
+    static inline int alive = 0;
+    explicit Counted( int initialValue ) : variable(initialValue) { ++alive; }
+    Counted( const Counted& o ) : variable(o.variable) { ++alive; }
+    Counted& operator=( const Counted& o ) = default;
+    ~Counted() { --alive; }
+    int getValue() const { return variable; }
+};
+static_assert( !std::is_default_constructible_v<Counted> );
+} /* anonymous */
+
+TEST(Arena, Initialization) {
+    EDF::Arena<64> arena;
+    EXPECT_TRUE( arena.isEmpty() );
+    EXPECT_FALSE( arena.isFull() );
+    EXPECT_EQ( arena.length(), 0 );
+    EXPECT_EQ( arena.maxLength(), 64 );
+    EXPECT_EQ( arena.remaining(), 64 );
+    EXPECT_EQ( arena.highWaterMark(), 0 );
+}
+
+TEST(Arena, AllocateUntilFull) {
+    EDF::Arena<16> arena;
+    void* first = arena.allocate( 10, 1 );
+    void* second = arena.allocate( 6, 1 );
+    ASSERT_NE( first, nullptr );
+    ASSERT_NE( second, nullptr );
+    EXPECT_EQ( static_cast<std::uint8_t*>(second), static_cast<std::uint8_t*>(first) + 10 );
+    EXPECT_TRUE( arena.isFull() );
+    EXPECT_EQ( arena.allocate( 1, 1 ), nullptr );
+    EXPECT_EQ( arena.length(), 16 );
+}
+
+TEST(Arena, Alignment) {
+    EDF::Arena<128> arena;
+    arena.allocate( 1, 1 );
+    auto* word = arena.allocate<std::uint32_t>( 1 );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>(word) % alignof(std::uint32_t), 0u );
+    EXPECT_EQ( arena.length(), 8 );
+
+    arena.allocate( 1, 1 );
+    void* wide = arena.allocate( 8, 32 );
+    ASSERT_NE( wide, nullptr );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>(wide) % 32, 0u );
+
+    // Padding that doesn't fit fails the same way as the size not fitting
+    EDF::Arena<16> small;
+    small.allocate( 1, 1 );
+    EXPECT_EQ( small.allocate( 1, 64 ), nullptr );
+    EXPECT_EQ( small.length(), 1 );
+}
+
+TEST(Arena, MarkRewind) {
+    EDF::Arena<64> arena;
+    arena.allocate( 16 );
+    const auto marker = arena.mark();
+    void* scratch = arena.allocate( 16 );
+    arena.allocate( 16 );
+    EXPECT_EQ( arena.length(), 48 );
+
+    arena.rewind( marker );
+    EXPECT_EQ( arena.length(), 16 );
+    EXPECT_EQ( arena.highWaterMark(), 48 );
+    // The rewound bytes are handed out again
+    EXPECT_EQ( arena.allocate( 16 ), scratch );
+
+    arena.reset();
+    EXPECT_TRUE( arena.isEmpty() );
+    EXPECT_EQ( arena.highWaterMark(), 48 );
+}
+
+TEST(Arena, Scope) {
+    EDF::Arena<64> arena;
+    arena.allocate( 8 );
+    {
+        auto scope = arena.scope();
+        arena.allocate( 32 );
+        {
+            EDF::Arena<64>::Scope inner( arena );
+            arena.allocate( 16 );
+            EXPECT_EQ( arena.length(), 64 );
+        }
+        EXPECT_EQ( arena.length(), 48 );
+    }
+    EXPECT_EQ( arena.length(), 8 );
+}
+
+TEST(ArenaVector, Initialization) {
+    EDF::Arena<256> arena;
+    EDF::ArenaVector<std::uint32_t> vector( arena, 10 );
+    EXPECT_TRUE( vector.isEmpty() );
+    EXPECT_FALSE( vector.isFull() );
+    EXPECT_EQ( vector.length(), 0 );
+    EXPECT_EQ( vector.maxLength(), 10 );
+    EXPECT_EQ( arena.length(), 10 * sizeof(std::uint32_t) );
+}
+
+TEST(ArenaVector, ArenaExhausted) {
+    EDF::Arena<64> arena;
+    EXPECT_DEATH( EDF::ArenaVector<std::uint32_t>( arena, 17 ), "" );
+    // Nothing was taken from the arena, so a smaller one still fits
+    EDF::ArenaVector<std::uint32_t> vector( arena, 16 );
+    EXPECT_EQ( vector.maxLength(), 16 );
+    EXPECT_DEATH( EDF::ArenaVector<std::uint32_t>( arena, 1 ), "" );
+}
+
+TEST(ArenaVector, PushInsertErase) {
+    EDF::Arena<256> arena;
+    EDF::ArenaVector<int> vector( arena, 8 );
+    vector.pushBack( 1 );
+    vector.pushBack( 4 );
+    vector.insert( vector.begin() + 1, 2 );
+    vector.emplace( vector.begin() + 2, 3 );
+    vector.emplaceBack( 5 );
+    ASSERT_EQ( vector.length(), 5 );
+    for( int k = 0; k < 5; ++k ) {
+        EXPECT_EQ( vector[static_cast<std::size_t>(k)], k + 1 );
+    }
+    EXPECT_EQ( vector.front(), 1 );
+    EXPECT_EQ( vector.back(), 5 );
+
+    auto it = vector.erase( vector.begin() + 1, vector.begin() + 3 );
+    EXPECT_EQ( *it, 4 );
+    EXPECT_EQ( vector.length(), 3 );
+    vector.erase( vector.begin() );
+    EXPECT_EQ( vector.front(), 4 );
+    EXPECT_EQ( vector.popBack(), 5 );
+    EXPECT_EQ( vector.length(), 1 );
+}
+
+TEST(ArenaVector, Full) {
+    EDF::Arena<256> arena;
+    EDF::ArenaVector<int> vector( arena, 3 );
+    for( int k = 0; k < 3; ++k ) {
+        vector.pushBack( k );
+    }
+    EXPECT_TRUE( vector.isFull() );
+    EXPECT_DEATH( vector.pushBack( 3 ), "" );
+}
+
+TEST(ArenaVector, DestroysElements) {
+    Counted::alive = 0;
+    EDF::Arena<256> arena;
+    {
+        EDF::ArenaVector<Counted> vector( arena, 4 );
+        vector.emplaceBack( 1 );
+        vector.emplaceBack( 2 );
+        vector.emplaceBack( 3 );
+        EXPECT_EQ( Counted::alive, 3 );
+        vector.erase( vector.begin() );
+        EXPECT_EQ( Counted::alive, 2 );
+        EXPECT_EQ( vector.front().getValue(), 2 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(ArenaVector, Append) {
+    EDF::Arena<256> arena;
+    EDF::ArenaVector<int> vector( arena, 8 );
+    const int values[] = { 1, 2, 3 };
+    vector.append( std::begin( values ), std::end( values ) );
+    std::istringstream stream( "4 5" );
+    vector.append( std::istream_iterator<int>( stream ), std::istream_iterator<int>() );
+    ASSERT_EQ( vector.length(), 5 );
+    EXPECT_EQ( vector.back(), 5 );
+
+    vector.assign( std::begin( values ), std::end( values ) );
+    EXPECT_EQ( vector.length(), 3 );
+    EXPECT_EQ( vector.back(), 3 );
+}
+
+TEST(ArenaVector, SpareCapacityCommit) {
+    EDF::Arena<256> arena;
+    EDF::ArenaVector<std::uint8_t> vector( arena, 16 );
+    vector.pushBack( 0xAA );
+    auto spare = vector.spareCapacity();
+    EXPECT_EQ( spare.length(), 15 );
+    spare[0] = 0xBB;
+    spare[1] = 0xCC;
+    vector.commit( 2 );
+    ASSERT_EQ( vector.length(), 3 );
+    EXPECT_EQ( vector[1], 0xBB );
+    EXPECT_EQ( vector[2], 0xCC );
+}
+
+TEST(ArenaVector, RewoundWithArena) {
+    EDF::Arena<256> arena;
+    const auto marker = arena.mark();
+    {
+        EDF::ArenaVector<std::uint64_t> first( arena, 4 );
+        EDF::ArenaVector<std::uint64_t> second( arena, 4 );
+        EXPECT_NE( first.data(), second.data() );
+        EXPECT_EQ( arena.length(), 64 );
+    }
+    arena.rewind( marker );
+    EXPECT_TRUE( arena.isEmpty() );
+}
+
+TEST(ArenaString, Initialization) {
+    EDF::Arena<64> arena;
+    EDF::ArenaString string( arena, 10 );
+    EXPECT_TRUE( string.isEmpty() );
+    EXPECT_FALSE( string.isFull() );
+    EXPECT_EQ( string.length(), 0 );
+    EXPECT_EQ( string.maxLength(), 10 );
+    EXPECT_STREQ( string.asCString(), "" );
+    EXPECT_EQ( arena.length(), 11 );
+}
+
+TEST(ArenaString, ArenaExhausted) {
+    EDF::Arena<16> arena;
+    EXPECT_DEATH( EDF::ArenaString( arena, 16 ), "" );
+    EDF::ArenaString string( arena, 15 );
+    EXPECT_EQ( string.maxLength(), 15 );
+    EXPECT_DEATH( EDF::ArenaString( arena, 0 ), "" );
+}
+
+TEST(ArenaString, Append) {
+    EDF::Arena<64> arena;
+    EDF::ArenaString string( arena, 32 );
+    string.append( "id=" ).append( 42 ).append( ',' ).append( EDF::String<8>( "hex=" ) ).append( 255u, 16 );
+    EXPECT_STREQ( string.asCString(), "id=42,hex=FF" );
+    EXPECT_EQ( string.length(), 12 );
+    EXPECT_TRUE( string.equals( "id=42,hex=FF" ) );
+    EXPECT_TRUE( string.equals( EDF::String<16>( "id=42,hex=FF" ) ) );
+}
+
+TEST(ArenaString, Full) {
+    EDF::Arena<64> arena;
+    EDF::ArenaString string( arena, 4 );
+    string.append( "abcd" );
+    EXPECT_TRUE( string.isFull() );
+    EXPECT_STREQ( string.asCString(), "abcd" );
+}
+
+TEST(ArenaString, FindEraseConvert) {
+    EDF::Arena<64> arena;
+    EDF::ArenaString string( arena, 32 );
+    string.append( "  Value: 1234  " );
+    string.trim( ' ' );
+    EXPECT_STREQ( string.asCString(), "Value: 1234" );
+    EXPECT_TRUE( string.contains( ':' ) );
+    EXPECT_TRUE( string.contains( "lue" ) );
+    EXPECT_FALSE( string.contains( "xyz" ) );
+
+    auto colon = string.find( ':' );
+    string.erase( string.begin(), colon + 2 );
+    EXPECT_STREQ( string.asCString(), "1234" );
+    EXPECT_EQ( string.toInt32_t(), 1234 );
+    EXPECT_EQ( string.toUint32_t( 16 ), 0x1234u );
+
+    string.clear();
+    string.append( "MiXeD" ).toLower();
+    EXPECT_STREQ( string.asCString(), "mixed" );
+    string.toUpper();
+    EXPECT_STREQ( string.asCString(), "MIXED" );
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/BitSet.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+
+TEST(BitSet, Initialization) {
+    EDF::BitSet<100> bits;
+    EXPECT_EQ( bits.size(), 100 );
+    EXPECT_EQ( bits.WORDS, 2 );
+    EXPECT_EQ( bits.count(), 0 );
+    EXPECT_TRUE( bits.none() );
+    EXPECT_FALSE( bits.any() );
+    EXPECT_FALSE( bits.all() );
+    EXPECT_EQ( bits.findFirstSet(), 100 );
+    EXPECT_EQ( bits.findFirstReset(), 0 );
+}
+
+TEST(BitSet, SetResetFlip) {
+    EDF::BitSet<130> bits;
+    bits.set( 0 ).set( 64 ).set( 129 );
+    EXPECT_TRUE( bits.test( 0 ) );
+    EXPECT_TRUE( bits.test( 64 ) );
+    EXPECT_TRUE( bits.test( 129 ) );
+    EXPECT_FALSE( bits.test( 1 ) );
+    EXPECT_EQ( bits.count(), 3 );
+    EXPECT_EQ( bits.word( 1 ), 1u );
+
+    bits.reset( 64 );
+    EXPECT_FALSE( bits.test( 64 ) );
+    bits.flip( 64 ).flip( 0 );
+    EXPECT_TRUE( bits.test( 64 ) );
+    EXPECT_FALSE( bits.test( 0 ) );
+    bits.set( 5, true ).set( 64, false );
+    EXPECT_TRUE( bits.test( 5 ) );
+    EXPECT_FALSE( bits.test( 64 ) );
+    EXPECT_EQ( bits.count(), 2 );
+
+    EXPECT_DEATH( bits.test( 130 ), "" );
+    EXPECT_DEATH( bits.set( 130 ), "" );
+}
+
+TEST(BitSet, AllBits) {
+    EDF::BitSet<70> bits;
+    bits.setAll();
+    EXPECT_TRUE( bits.all() );
+    EXPECT_EQ( bits.count(), 70 );
+    // Bits past N stay 0
+    EXPECT_EQ( bits.word( 1 ), 0x3Fu );
+    EXPECT_EQ( bits.findFirstReset(), 70 );
+
+    bits.reset( 66 );
+    EXPECT_FALSE( bits.all() );
+    EXPECT_EQ( bits.findFirstReset(), 66 );
+
+    bits.flipAll();
+    EXPECT_EQ( bits.count(), 1 );
+    EXPECT_TRUE( bits.test( 66 ) );
+    EXPECT_EQ( (~bits).count(), 69 );
+
+    bits.resetAll();
+    EXPECT_TRUE( bits.none() );
+
+    EDF::BitSet<128> full;
+    full.setAll();
+    EXPECT_TRUE( full.all() );
+    EXPECT_EQ( full.count(), 128 );
+    EXPECT_EQ( full.findFirstReset(), 128 );
+}
+
+TEST(BitSet, FindSet) {
+    EDF::BitSet<200> bits;
+    const std::size_t expected[] = { 3, 63, 64, 65, 127, 128, 199 };
+    for( const auto index : expected ) {
+        bits.set( index );
+    }
+    std::size_t k = 0;
+    for( std::size_t i = bits.findFirstSet(); i < bits.size(); i = bits.findNextSet( i ) ) {
+        ASSERT_LT( k, std::size( expected ) );
+        EXPECT_EQ( i, expected[k++] );
+    }
+    EXPECT_EQ( k, std::size( expected ) );
+    EXPECT_EQ( bits.findNextSet( 199 ), 200 );
+    EXPECT_EQ( bits.findNextSet( 4 ), 63 );
+}
+
+TEST(BitSet, SetOperations) {
+    EDF::BitSet<96> lhs;
+    EDF::BitSet<96> rhs;
+    lhs.set( 1 ).set( 70 ).set( 90 );
+    rhs.set( 70 ).set( 2 );
+
+    const auto both = lhs & rhs;
+    EXPECT_EQ( both.count(), 1 );
+    EXPECT_TRUE( both.test( 70 ) );
+
+    const auto either = lhs | rhs;
+    EXPECT_EQ( either.count(), 4 );
+
+    const auto different = lhs ^ rhs;
+    EXPECT_EQ( different.count(), 3 );
+    EXPECT_FALSE( different.test( 70 ) );
+
+    auto copy = lhs;
+    EXPECT_EQ( copy, lhs );
+    copy ^= lhs;
+    EXPECT_TRUE( copy.none() );
+    EXPECT_NE( copy, lhs );
+}
+
+TEST(BitSet, MatchesStdBitset) {
+    constexpr std::size_t N = 300;
+    EDF::BitSet<N> bits;
+    std::bitset<N> reference;
+    std::mt19937 random( 42 );
+    for( int k = 0; k < 2000; ++k ) {
+        const std::size_t index = random() % N;
+        switch( random() % 3 ) {
+        case 0: bits.set( index );   reference.set( index );   break;
+        case 1: bits.reset( index ); reference.reset( index ); break;
+        default: bits.flip( index ); reference.flip( index );  break;
+        }
+        ASSERT_EQ( bits.count(), reference.count() );
+    }
+    for( std::size_t i = 0; i < N; ++i ) {
+        EXPECT_EQ( bits.test( i ), reference.test( i ) );
+    }
+    EXPECT_EQ( bits.findFirstSet(), reference._Find_first() );
+    for( std::size_t i = 0; i < N; ++i ) {
+        EXPECT_EQ( bits.findNextSet( i ), reference._Find_next( i ) );
+    }
+}
+
+namespace {
+constexpr EDF::BitSet<80> makeMask() {
+    EDF::BitSet<80> mask;
+    mask.set( 2 ).set( 75 );
+    return mask;
+}
+static_assert( makeMask().count() == 2 );
+static_assert( makeMask().findNextSet( 2 ) == 75 );
+static_assert( (~makeMask()).count() == 78 );
+} /* anonymous */
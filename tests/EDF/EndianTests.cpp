@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Endian.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Endian, LoadBigEndian) {
+    const uint8_t bytes[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+    EXPECT_EQ( EDF::loadBe<uint8_t>( bytes ), 0x12 );
+    EXPECT_EQ( EDF::loadBe<uint16_t>( bytes ), 0x1234 );
+    EXPECT_EQ( EDF::loadBe<uint32_t>( bytes ), 0x12345678 );
+    EXPECT_EQ( EDF::loadBe<uint64_t>( bytes ), 0x123456789ABCDEF0 );
+    EXPECT_EQ( EDF::loadBe<int16_t>( bytes + 4 ), static_cast<int16_t>(0x9ABC) );
+}
+
+TEST(Endian, LoadLittleEndian) {
+    const uint8_t bytes[] = { 0xF0, 0xDE, 0xBC, 0x9A, 0x78, 0x56, 0x34, 0x12 };
+    EXPECT_EQ( EDF::loadLe<uint16_t>( bytes + 6 ), 0x1234 );
+    EXPECT_EQ( EDF::loadLe<uint32_t>( bytes + 4 ), 0x12345678 );
+    EXPECT_EQ( EDF::loadLe<uint64_t>( bytes ), 0x123456789ABCDEF0 );
+    EXPECT_EQ( EDF::loadLe<int32_t>( bytes ), static_cast<int32_t>(0x9ABCDEF0) );
+}
+
+TEST(Endian, LoadConstexpr) {
+    constexpr uint8_t bytes[] = { 0x12, 0x34 };
+    static_assert( EDF::loadBe<uint16_t>( bytes ) == 0x1234 );
+    static_assert( EDF::loadLe<uint16_t>( bytes ) == 0x3412 );
+}
+
+TEST(Endian, Float) {
+    const uint8_t onePointFiveBe[] = { 0x3F, 0xC0, 0x00, 0x00 };
+    const uint8_t onePointFiveLe[] = { 0x00, 0x00, 0xC0, 0x3F };
+    EXPECT_EQ( EDF::loadBe<float>( onePointFiveBe ), 1.5f );
+    EXPECT_EQ( EDF::loadLe<float>( onePointFiveLe ), 1.5f );
+
+    const uint8_t minusTwoBe[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    EXPECT_EQ( EDF::loadBe<double>( minusTwoBe ), -2.0 );
+}
+
+TEST(Endian, Enum) {
+    enum class Command : uint16_t { reset = 0x0102 };
+    const uint8_t bytes[] = { 0x01, 0x02 };
+    EXPECT_EQ( EDF::loadBe<Command>( bytes ), Command::reset );
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/FlatMap.hpp>
+#include <EDF/Color.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string_view>
+
+TEST(FlatMap, LowerBound) {
+    const int values[] = { 1, 3, 3, 5, 7, 9, 11 };
+    auto less = []( int lhs, int rhs ){ return lhs < rhs; };
+    for( std::size_t length = 0; length <= std::size(values); ++length ) {
+        for( int key = 0; key <= 12; ++key ) {
+            EXPECT_EQ( EDF::impl::lowerBound( values, length, key, less ), std::lower_bound( values, values + length, key ) );
+        }
+    }
+}
+
+TEST(FlatMap, Initialization) {
+    EDF::FlatMap<uint32_t, int, 8> map;
+    EXPECT_TRUE( map.isEmpty() );
+    EXPECT_FALSE( map.isFull() );
+    EXPECT_EQ( map.length(), 0 );
+    EXPECT_EQ( map.maxLength(), 8 );
+    EXPECT_EQ( map.find( 1 ), nullptr );
+}
+
+TEST(FlatMap, InsertFindErase) {
+    EDF::FlatMap<uint32_t, int, 8> map;
+    map.insert( 30, 3 );
+    map.insert( 10, 1 );
+    map.insert( 20, 2 );
+    EXPECT_EQ( map.length(), 3 );
+    EXPECT_EQ( map.at( 10 ), 1 );
+    EXPECT_EQ( *map.find( 20 ), 2 );
+    EXPECT_TRUE( map.contains( 30 ) );
+    EXPECT_FALSE( map.contains( 25 ) );
+    EXPECT_EQ( map.lowerBound( 25 )->key, 30 );
+
+    // Kept sorted by key
+    uint32_t previous = 0;
+    for( const auto& entry : map ) {
+        EXPECT_LT( previous, entry.key );
+        previous = entry.key;
+    }
+
+    map.insert( 20, 22 );
+    EXPECT_EQ( map.length(), 3 );
+    EXPECT_EQ( map.at( 20 ), 22 );
+
+    EXPECT_TRUE( map.erase( 10 ) );
+    EXPECT_FALSE( map.erase( 10 ) );
+    EXPECT_EQ( map.begin()->key, 20 );
+    EXPECT_DEATH( map.at( 10 ), "" );
+}
+
+TEST(FlatMap, Emplace) {
+    EDF::FlatMap<uint32_t, std::unique_ptr<int>, 4> map;
+    EXPECT_EQ( *map.emplace( 2, new int( 20 ) ), 20 );
+    EXPECT_EQ( *map.emplace( 1, new int( 10 ) ), 10 );
+    // Existing key, the value is left untouched
+    int* ignored = new int( 99 );
+    EXPECT_EQ( *map.emplace( 2, ignored ), 20 );
+    delete ignored;
+    EXPECT_EQ( map.length(), 2 );
+}
+
+TEST(FlatMap, InsertSorted) {
+    EDF::FlatMap<uint32_t, uint32_t, 16> map;
+    map.insert( 2, 2 );
+    map.insert( 5, 5 );
+    map.insert( 9, 9 );
+    const EDF::KeyValue<uint32_t, uint32_t> more[] = { { 0, 0 }, { 3, 3 }, { 4, 4 }, { 10, 10 }, { 11, 11 } };
+    map.insertSorted( std::begin( more ), std::end( more ) );
+    ASSERT_EQ( map.length(), 8 );
+    const uint32_t expected[] = { 0, 2, 3, 4, 5, 9, 10, 11 };
+    std::size_t k = 0;
+    for( const auto& entry : map ) {
+        EXPECT_EQ( entry.key, expected[k] );
+        EXPECT_EQ( entry.value, expected[k] );
+        ++k;
+    }
+
+    const EDF::KeyValue<uint32_t, uint32_t> duplicate[] = { { 5, 0 } };
+    EXPECT_DEATH( map.insertSorted( std::begin( duplicate ), std::end( duplicate ) ), "" );
+}
+
+TEST(FlatMap, MatchesStdLowerBound) {
+    EDF::FlatMap<uint32_t, uint32_t, 64> map;
+    std::mt19937 random( 99 );
+    while( !map.isFull() ) {
+        const auto key = static_cast<uint32_t>(random() % 1000);
+        map.insert( key, key );
+    }
+    for( uint32_t key = 0; key < 1000; ++key ) {
+        auto it = std::lower_bound( map.begin(), map.end(), key, []( const auto& entry, uint32_t k ){ return entry.key < k; } );
+        EXPECT_EQ( map.lowerBound( key ), it );
+        EXPECT_EQ( map.contains( key ), (it != map.end()) && (it->key == key) );
+    }
+}
+
+TEST(FlatMap, CustomCompare) {
+    EDF::FlatMap<int, int, 4, std::greater<int>> map;
+    map.insert( 1, 1 );
+    map.insert( 3, 3 );
+    map.insert( 2, 2 );
+    EXPECT_EQ( map.begin()->key, 3 );
+    EXPECT_EQ( map.at( 2 ), 2 );
+}
+
+TEST(FlatSet, InsertContainsErase) {
+    EDF::FlatSet<int, 8> set;
+    EXPECT_TRUE( set.isEmpty() );
+    EXPECT_TRUE( set.insert( 5 ) );
+    EXPECT_TRUE( set.insert( 1 ) );
+    EXPECT_TRUE( set.insert( 3 ) );
+    EXPECT_FALSE( set.insert( 3 ) );
+    EXPECT_EQ( set.length(), 3 );
+    EXPECT_TRUE( set.contains( 1 ) );
+    EXPECT_FALSE( set.contains( 2 ) );
+    EXPECT_EQ( *set.lowerBound( 2 ), 3 );
+    EXPECT_TRUE( std::is_sorted( set.begin(), set.end() ) );
+
+    EXPECT_TRUE( set.erase( 1 ) );
+    EXPECT_FALSE( set.erase( 1 ) );
+    EXPECT_EQ( *set.begin(), 3 );
+}
+
+TEST(FlatSet, InsertSorted) {
+    EDF::FlatSet<int, 16> set;
+    set.insert( 4 );
+    set.insert( 8 );
+    const int more[] = { 1, 2, 6, 9 };
+    set.insertSorted( std::begin( more ), std::end( more ) );
+    const int expected[] = { 1, 2, 4, 6, 8, 9 };
+    ASSERT_EQ( set.length(), 6 );
+    EXPECT_TRUE( std::equal( set.begin(), set.end(), std::begin( expected ) ) );
+
+    EDF::FlatSet<int, 4> empty;
+    empty.insertSorted( std::begin( more ), std::end( more ) );
+    EXPECT_TRUE( std::equal( empty.begin(), empty.end(), std::begin( more ) ) );
+}
+
+namespace {
+constexpr auto colors = EDF::makeConstFlatMap<std::string_view, EDF::Color>( {
+    { "red",    EDF::Color::red() },
+    { "green",  EDF::Color::green() },
+    { "blue",   EDF::Color::blue() },
+    { "white",  EDF::Color::white() },
+    { "black",  EDF::Color::black() },
+} );
+static_assert( colors.length() == 5 );
+static_assert( colors.at( "blue" ).asRGB() == 0x0000FF );
+static_assert( colors.contains( "white" ) );
+static_assert( !colors.contains( "purple" ) );
+static_assert( colors.begin()->key == "black" );
+
+constexpr auto opcodes = EDF::makeConstFlatSet<uint8_t>( { 0x20, 0x03, 0x10, 0x01 } );
+static_assert( opcodes.contains( 0x10 ) );
+static_assert( !opcodes.contains( 0x02 ) );
+static_assert( *opcodes.begin() == 0x01 );
+} /* anonymous */
+
+TEST(ConstFlatMap, RuntimeLookup) {
+    std::string_view name = "green";
+    ASSERT_NE( colors.find( name ), nullptr );
+    EXPECT_EQ( colors.find( name )->asRGB(), 0x00FF00u );
+    EXPECT_EQ( colors.find( "grey" ), nullptr );
+    EXPECT_TRUE( std::is_sorted( colors.begin(), colors.end(), []( const auto& lhs, const auto& rhs ){ return lhs.key < rhs.key; } ) );
+}
+
+TEST(ConstFlatSet, RuntimeLookup) {
+    EXPECT_TRUE( opcodes.contains( 0x03 ) );
+    EXPECT_FALSE( opcodes.contains( 0x04 ) );
+    EXPECT_TRUE( std::is_sorted( opcodes.begin(), opcodes.end() ) );
+}
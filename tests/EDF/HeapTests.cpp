@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
 class CustomClass {
 private:
     int variable;
@@ -37,6 +41,12 @@ TEST(Heap, InitializationInt) {
     EXPECT_EQ( heapIntMin.pop(), 3 );
 }
 
+namespace {
+constexpr EDF::HeapMin<int, 4> constantHeap = { 3, 1, -2 };
+static_assert( constantHeap.length() == 3 );
+static_assert( constantHeap.peek() == -2 );
+} /* anonymous */
+
 TEST(Heap, InitializationCustomClass) {
     EDF::Heap<CustomClass, 32, std::less<CustomClass>> heapCustomClass;
     EXPECT_EQ( heapCustomClass.maxLength(), 32 );
@@ -171,6 +181,16 @@ TEST(Heap, Emplace) {
     EXPECT_EQ( heap.peek().getValue(), 0 );
 }
 
+TEST(Heap, EmplaceReturnsElement) {
+    EDF::HeapMin<CustomClass, 10> heap = { 10, 20, 30, 40 };
+
+    auto& value = heap.emplace( 5 );
+    EXPECT_EQ( value.getValue(), 5 );
+    EXPECT_EQ( &value, &heap.peek() );
+
+    EXPECT_EQ( heap.emplace( 35 ).getValue(), 35 );
+}
+
 TEST(Heap, Pop) {
     EDF::HeapMin<int, 4> heap = { 5, 10, 8, 3 };
 
@@ -185,4 +205,187 @@ TEST(Heap, Clear) {
 
     heap.clear();
     EXPECT_EQ( heap.length(), 0 );
-}
\ No newline at end of file
+}
+
+TEST(Heap, PushPopSorted) {
+    EDF::HeapMin<int, 64> heap;
+    int values[64] = {};
+    std::uint32_t state = 12345;
+    for( auto& value : values ) {
+        state = state * 1103515245u + 12345u;
+        value = static_cast<int>((state >> 16) % 100);
+        heap.push( value );
+    }
+    std::sort( std::begin(values), std::end(values) );
+    for( auto value : values ) {
+        EXPECT_EQ( heap.pop(), value );
+    }
+    EXPECT_TRUE( heap.isEmpty() );
+}
+
+TEST(Heap, Arity) {
+    EDF::HeapMin<int, 100, 4> heap4;
+    EDF::HeapMax<int, 100, 8> heap8;
+    EDF::Heap<int, 100, std::less<int>, 3> heap3;
+    int values[100] = {};
+    std::uint32_t state = 777;
+    for( auto& value : values ) {
+        state = state * 1103515245u + 12345u;
+        value = static_cast<int>((state >> 16) % 1000);
+        heap4.push( value );
+        heap8.push( value );
+        heap3.push( value );
+    }
+    std::sort( std::begin(values), std::end(values) );
+    for( std::size_t k = 0; k < 100; ++k ) {
+        EXPECT_EQ( heap4.pop(), values[k] );
+        EXPECT_EQ( heap3.pop(), values[k] );
+        EXPECT_EQ( heap8.pop(), values[99 - k] );
+    }
+
+    EDF::HeapMin<int, 9, 4> heapIList = { 9, 4, 7, 1, 8, 2, 6, 3, 5 };
+    for( int k = 1; k <= 9; ++k ) {
+        EXPECT_EQ( heapIList.pop(), k );
+    }
+}
+
+TEST(Heap, Assign) {
+    const int values[] = { 9, 4, 7, 1, 8, 2, 6, 3, 5 };
+    EDF::HeapMin<int, 16> heap = { 100, 200 };
+    heap.assign( std::begin(values), std::end(values) );
+    EXPECT_EQ( heap.length(), 9 );
+    for( int k = 1; k <= 9; ++k ) {
+        EXPECT_EQ( heap.pop(), k );
+    }
+
+    heap.assign( std::begin(values), std::begin(values) );
+    EXPECT_TRUE( heap.isEmpty() );
+
+    EDF::HeapMin<int, 4> small;
+    EXPECT_DEATH( small.assign( std::begin(values), std::end(values) ), "" );
+}
+
+TEST(Heap, PushBatch) {
+    EDF::HeapMax<int, 64, 4> heap;
+    int expected[64] = {};
+    std::size_t n = 0;
+    std::uint32_t state = 4242;
+    // Batches smaller and larger than the heap take both the sift up and the re-heapify paths
+    for( std::size_t batch : { 1, 20, 3, 30, 2 } ) {
+        int values[32] = {};
+        for( std::size_t k = 0; k < batch; ++k ) {
+            state = state * 1103515245u + 12345u;
+            values[k] = static_cast<int>((state >> 16) % 500);
+            expected[n++] = values[k];
+        }
+        heap.pushBatch( values, values + batch );
+        EXPECT_EQ( heap.length(), n );
+    }
+    std::sort( expected, expected + n );
+    for( std::size_t k = n; k > 0; --k ) {
+        EXPECT_EQ( heap.pop(), expected[k - 1] );
+    }
+}
+
+TEST(Heap, Merge) {
+    EDF::HeapMin<int, 16> heap = { 5, 1, 9 };
+    EDF::HeapMin<int, 4> other = { 4, 8, 2 };
+    EDF::HeapMin<int, 8, 4> otherArity = { 7, 3, 6 };
+
+    heap.merge( other );
+    heap.merge( otherArity );
+    EXPECT_EQ( heap.length(), 9 );
+    EXPECT_EQ( other.length(), 3 );
+    for( int k = 1; k <= 9; ++k ) {
+        EXPECT_EQ( heap.pop(), k );
+    }
+}
+
+TEST(Heap, TopK) {
+    EDF::HeapMin<int, 64> heap;
+    int values[64] = {};
+    std::uint32_t state = 31337;
+    for( auto& value : values ) {
+        state = state * 1103515245u + 12345u;
+        value = static_cast<int>((state >> 16) % 1000);
+        heap.push( value );
+    }
+    std::sort( std::begin(values), std::end(values) );
+
+    int top[10] = {};
+    EXPECT_EQ( heap.topK( 10, top ), top + 10 );
+    for( std::size_t k = 0; k < 10; ++k ) {
+        EXPECT_EQ( top[k], values[k] );
+    }
+    EXPECT_EQ( heap.length(), 64 );
+
+    int all[64] = {};
+    EXPECT_EQ( (heap.topK<64>( 64, all )), all + 64 );
+    for( std::size_t k = 0; k < 64; ++k ) {
+        EXPECT_EQ( all[k], values[k] );
+    }
+
+    EDF::HeapMax<int, 8, 4> small = { 3, 1, 2 };
+    int three[5] = {};
+    EXPECT_EQ( small.topK( 5, three ), three + 3 );
+    EXPECT_EQ( three[0], 3 );
+    EXPECT_EQ( three[1], 2 );
+    EXPECT_EQ( three[2], 1 );
+    EXPECT_DEATH( small.topK( 17, three ), "" );
+}
+
+TEST(Heap, SortInto) {
+    EDF::HeapMin<int, 16, 4> heap = { 9, 4, 7, 1, 8, 2, 6, 3, 5 };
+    auto sorted = heap.sortInto();
+    EXPECT_EQ( sorted.length(), 9 );
+    for( std::size_t k = 0; k < sorted.length(); ++k ) {
+        EXPECT_EQ( sorted[k], static_cast<int>(k + 1) );
+    }
+    // Still a valid heap afterwards
+    heap.push( 0 );
+    heap.push( 10 );
+    for( int k = 0; k <= 10; ++k ) {
+        EXPECT_EQ( heap.pop(), k );
+    }
+
+    EDF::HeapMax<int, 4> empty;
+    EXPECT_TRUE( empty.sortInto().isEmpty() );
+}
+
+TEST(Heap, StatefulComparator) {
+    // Deadlines on a wrapping tick counter, ordered relative to "now"
+    struct DeadlineOrder {
+        std::uint8_t now = 0;
+        constexpr bool operator()( std::uint8_t lhs, std::uint8_t rhs ) const {
+            return static_cast<std::uint8_t>(lhs - now) < static_cast<std::uint8_t>(rhs - now);
+        }
+    };
+    EDF::Heap<std::uint8_t, 8, DeadlineOrder> heap( DeadlineOrder{ 250 } );
+    EXPECT_EQ( heap.comparator().now, 250 );
+
+    heap.push( 4 );
+    heap.push( 252 );
+    heap.push( 0 );
+    heap.push( 255 );
+    EXPECT_EQ( heap.pop(), 252 );
+    EXPECT_EQ( heap.pop(), 255 );
+    EXPECT_EQ( heap.pop(), 0 );
+    EXPECT_EQ( heap.pop(), 4 );
+}
+
+TEST(Heap, NotDefaultConstructible) {
+    struct Job {
+        int priority;
+        explicit Job( int p ) : priority(p) {}
+        bool operator<( const Job& other ) const { return priority < other.priority; }
+    };
+    static_assert( !std::is_default_constructible_v<Job> );
+
+    EDF::Heap<Job, 8, std::less<Job>> heap;
+    heap.push( Job( 5 ) );
+    heap.emplace( 1 );
+    heap.push( Job( 3 ) );
+    EXPECT_EQ( heap.pop().priority, 1 );
+    EXPECT_EQ( heap.pop().priority, 3 );
+    EXPECT_EQ( heap.pop().priority, 5 );
+}
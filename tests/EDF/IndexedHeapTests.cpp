@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/IndexedHeap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+
+TEST(IndexedHeap, Initialization) {
+    EDF::IndexedHeapMin<int, 16> heap;
+    EXPECT_EQ( heap.maxLength(), 16 );
+    EXPECT_EQ( heap.length(), 0 );
+    EXPECT_TRUE( heap.isEmpty() );
+    EXPECT_FALSE( heap.contains( 0 ) );
+}
+
+TEST(IndexedHeap, PushPop) {
+    EDF::IndexedHeapMin<int, 4> heap;
+    auto h5 = heap.push( 5 );
+    auto h3 = heap.push( 3 );
+    auto h8 = heap.push( 8 );
+    auto h1 = heap.push( 1 );
+    EXPECT_TRUE( heap.isFull() );
+    EXPECT_EQ( heap.peek(), 1 );
+    EXPECT_EQ( heap.peekHandle(), h1 );
+    EXPECT_EQ( heap[h5], 5 );
+    EXPECT_EQ( heap.at( h3 ), 3 );
+    EXPECT_EQ( heap.at( h8 ), 8 );
+
+    EXPECT_EQ( heap.pop(), 1 );
+    EXPECT_FALSE( heap.contains( h1 ) );
+    EXPECT_TRUE( heap.contains( h3 ) );
+    EXPECT_EQ( heap.pop(), 3 );
+    EXPECT_EQ( heap.pop(), 5 );
+    EXPECT_EQ( heap.pop(), 8 );
+    EXPECT_TRUE( heap.isEmpty() );
+    EXPECT_DEATH( heap.pop(), "" );
+    EXPECT_DEATH( heap.peekHandle(), "" );
+}
+
+TEST(IndexedHeap, HandlesReused) {
+    EDF::IndexedHeapMax<int, 2> heap;
+    auto a = heap.push( 1 );
+    auto b = heap.push( 2 );
+    EXPECT_NE( a, b );
+    heap.erase( a );
+    auto c = heap.push( 3 );
+    EXPECT_EQ( c, a );
+    EXPECT_EQ( heap[b], 2 );
+    EXPECT_EQ( heap[c], 3 );
+
+    heap.clear();
+    EXPECT_FALSE( heap.contains( b ) );
+    EXPECT_FALSE( heap.contains( c ) );
+}
+
+TEST(IndexedHeap, Update) {
+    EDF::IndexedHeapMin<int, 8> heap;
+    auto h10 = heap.push( 10 );
+    auto h20 = heap.push( 20 );
+    auto h30 = heap.push( 30 );
+    auto h40 = heap.push( 40 );
+
+    heap.update( h40, 5 );
+    EXPECT_EQ( heap.peekHandle(), h40 );
+    EXPECT_EQ( heap[h40], 5 );
+
+    heap.update( h40, 35 );
+    EXPECT_EQ( heap.peekHandle(), h10 );
+
+    heap.update( h10, 25 );
+    EXPECT_EQ( heap.pop(), 20 );
+    EXPECT_EQ( heap.pop(), 25 );
+    EXPECT_EQ( heap.pop(), 30 );
+    EXPECT_EQ( heap.pop(), 35 );
+    EXPECT_FALSE( heap.contains( h20 ) );
+    EXPECT_FALSE( heap.contains( h30 ) );
+}
+
+TEST(IndexedHeap, Erase) {
+    EDF::IndexedHeapMin<int, 8> heap;
+    auto h4 = heap.push( 4 );
+    auto h9 = heap.push( 9 );
+    auto h7 = heap.push( 7 );
+    auto h2 = heap.push( 2 );
+    auto h8 = heap.push( 8 );
+
+    EXPECT_EQ( heap.erase( h4 ), 4 );
+    EXPECT_FALSE( heap.contains( h4 ) );
+    EXPECT_EQ( heap.erase( h2 ), 2 );
+    EXPECT_EQ( heap.length(), 3 );
+    EXPECT_EQ( heap[h7], 7 );
+    EXPECT_EQ( heap[h8], 8 );
+    EXPECT_EQ( heap[h9], 9 );
+    EXPECT_EQ( heap.pop(), 7 );
+    EXPECT_EQ( heap.pop(), 8 );
+    EXPECT_EQ( heap.pop(), 9 );
+    EXPECT_DEATH( heap.erase( h9 ), "" );
+}
+
+TEST(IndexedHeap, Emplace) {
+    struct Timer {
+        std::uint32_t deadline;
+        int id;
+        Timer( std::uint32_t d = 0, int i = 0 ) : deadline(d), id(i) {}
+        bool operator<( const Timer& rhs ) const { return deadline < rhs.deadline; }
+    };
+    EDF::IndexedHeapMin<Timer, 4> heap;
+    auto slow = heap.emplace( 100u, 1 );
+    auto fast = heap.emplace( 10u, 2 );
+    EXPECT_EQ( heap.peek().id, 2 );
+
+    heap.update( slow, Timer( 5u, 1 ) );
+    EXPECT_EQ( heap.peekHandle(), slow );
+    EXPECT_EQ( heap.erase( fast ).id, 2 );
+    EXPECT_EQ( heap.length(), 1 );
+}
+
+TEST(IndexedHeap, RandomOperations) {
+    constexpr std::size_t N = 64;
+    EDF::IndexedHeapMin<int, N> heap;
+    int expected[N] = {};
+    bool live[N] = {};
+    std::uint32_t state = 987654321;
+    auto next = [&state](){ state = state * 1103515245u + 12345u; return state >> 16; };
+
+    for( int round = 0; round < 2000; ++round ) {
+        const auto op = next() % 4;
+        const int value = static_cast<int>(next() % 1000);
+        if( (op == 0 || heap.isEmpty()) && !heap.isFull() ) {
+            auto handle = heap.push( value );
+            ASSERT_LT( handle, N );
+            ASSERT_FALSE( live[handle] );
+            live[handle] = true;
+            expected[handle] = value;
+            continue;
+        }
+        std::size_t handle = next() % N;
+        while( !live[handle] ) {
+            handle = (handle + 1) % N;
+        }
+        if( op == 1 ) {
+            heap.update( handle, value );
+            expected[handle] = value;
+        }
+        else if( op == 2 ) {
+            EXPECT_EQ( heap.erase( handle ), expected[handle] );
+            live[handle] = false;
+        }
+        else {
+            int smallest = 1000;
+            for( std::size_t k = 0; k < N; ++k ) {
+                if( live[k] ) {
+                    smallest = std::min( smallest, expected[k] );
+                }
+            }
+            EXPECT_EQ( heap.peek(), smallest );
+            EXPECT_EQ( expected[heap.peekHandle()], smallest );
+            live[heap.peekHandle()] = false;
+            heap.pop();
+        }
+        for( std::size_t k = 0; k < N; ++k ) {
+            ASSERT_EQ( heap.contains( k ), live[k] );
+            if( live[k] ) {
+                ASSERT_EQ( heap[k], expected[k] );
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/MPMCQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(MPMCQueue, Initialization) {
+    EDF::MPMCQueue<int, 32> queue;
+    EXPECT_EQ( queue.maxLength(), 32 );
+    EXPECT_EQ( queue.length(), 0 );
+    EXPECT_TRUE( queue.isEmpty() );
+    EXPECT_FALSE( queue.isFull() );
+}
+
+TEST(MPMCQueue, PushFull) {
+    EDF::MPMCQueue<int, 4> queue;
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_TRUE( queue.push( k ) );
+    }
+    EXPECT_TRUE( queue.isFull() );
+    EXPECT_EQ( queue.length(), 4 );
+    EXPECT_FALSE( queue.push( 4 ) );
+    EXPECT_EQ( queue.length(), 4 );
+
+    int value = -1;
+    EXPECT_TRUE( queue.pop( value ) );
+    EXPECT_EQ( value, 0 );
+    EXPECT_TRUE( queue.push( 4 ) );
+}
+
+TEST(MPMCQueue, PopEmpty) {
+    EDF::MPMCQueue<int, 4> queue;
+    int value = -1;
+    EXPECT_FALSE( queue.pop( value ) );
+    EXPECT_EQ( value, -1 );
+
+    queue.push( 7 );
+    EXPECT_TRUE( queue.pop( value ) );
+    EXPECT_EQ( value, 7 );
+    EXPECT_FALSE( queue.pop( value ) );
+    EXPECT_EQ( value, 7 );
+}
+
+TEST(MPMCQueue, PushPopWrap) {
+    EDF::MPMCQueue<int, 4> queuePow2;
+    EDF::MPMCQueue<int, 5> queueNotPow2;
+    for( int k = 0; k < 20; ++k ) {
+        queuePow2.push( k );
+        queuePow2.push( k + 100 );
+        queueNotPow2.push( k );
+        queueNotPow2.push( k + 100 );
+        EXPECT_EQ( queuePow2.length(), 2 );
+        EXPECT_EQ( queueNotPow2.length(), 2 );
+
+        int value = 0;
+        queuePow2.pop( value );         EXPECT_EQ( value, k );
+        queuePow2.pop( value );         EXPECT_EQ( value, k + 100 );
+        queueNotPow2.pop( value );      EXPECT_EQ( value, k );
+        queueNotPow2.pop( value );      EXPECT_EQ( value, k + 100 );
+    }
+    EXPECT_TRUE( queuePow2.isEmpty() );
+    EXPECT_TRUE( queueNotPow2.isEmpty() );
+}
+
+TEST(MPMCQueue, Emplace) {
+    struct Pair { int a; int b; Pair( int x = 0, int y = 0 ) : a(x), b(y) {} };
+    EDF::MPMCQueue<Pair, 2> queue;
+    EXPECT_TRUE( queue.emplace( 1, 2 ) );
+    EXPECT_TRUE( queue.emplace( 3, 4 ) );
+    EXPECT_FALSE( queue.emplace( 5, 6 ) );
+
+    Pair pair;
+    queue.pop( pair );
+    EXPECT_EQ( pair.a, 1 );
+    EXPECT_EQ( pair.b, 2 );
+    queue.pop( pair );
+    EXPECT_EQ( pair.a, 3 );
+    EXPECT_EQ( pair.b, 4 );
+}
+
+TEST(MPMCQueue, ProducersConsumersThreads) {
+    constexpr std::uint32_t THREADS = 4;
+    constexpr std::uint32_t COUNT = 50000;
+    static EDF::MPMCQueue<std::uint32_t, 64> queue;
+    static std::atomic<std::uint32_t> seen[THREADS * COUNT];
+    std::atomic<std::uint32_t> consumed{0};
+
+    std::vector<std::thread> threads;
+    for( std::uint32_t p = 0; p < THREADS; ++p ) {
+        threads.emplace_back( [p](){
+            for( std::uint32_t k = 0; k < COUNT; ++k ) {
+                while( !queue.push( p * COUNT + k ) ) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for( std::uint32_t c = 0; c < THREADS; ++c ) {
+        threads.emplace_back( [&consumed](){
+            std::uint32_t value = 0;
+            while( consumed.load() < THREADS * COUNT ) {
+                if( queue.pop( value ) ) {
+                    seen[value].fetch_add( 1 );
+                    consumed.fetch_add( 1 );
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for( auto& thread : threads ) {
+        thread.join();
+    }
+
+    std::uint32_t notOnce = 0;
+    for( const auto& count : seen ) {
+        if( count.load() != 1 ) {
+            ++notOnce;
+        }
+    }
+    EXPECT_EQ( notOnce, 0 );
+    EXPECT_TRUE( queue.isEmpty() );
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <type_traits>
+
+namespace {
+class Counted {
+private:
+    int variable;
+public:
+    static inline int alive = 0;
+    explicit Counted( int initialValue ) : variable(initialValue) { ++alive; }
+    Counted( const Counted& o ) : variable(o.variable) { ++alive; }
+    Counted( Counted&& o ) : variable(o.variable) { ++alive; }
+    Counted& operator=( const Counted& o ) = default;
+    ~Counted() { --alive; }
+    int getValue() const { return variable; }
+};
+static_assert( !std::is_default_constructible_v<Counted> );
+} /* anonymous */
+
+// Sends every key to the same home slot, to force long probe sequences
+struct CollidingHash {
+    constexpr uint32_t operator()( uint32_t ) const { return 0; }
+};
+
+TEST(Map, Initialization) {
+    EDF::Map<uint32_t, int, 8> map;
+    EXPECT_TRUE( map.isEmpty() );
+    EXPECT_FALSE( map.isFull() );
+    EXPECT_EQ( map.length(), 0 );
+    EXPECT_EQ( map.maxLength(), 8 );
+    EXPECT_EQ( map.begin(), map.end() );
+    EXPECT_EQ( map.find( 1 ), nullptr );
+}
+
+TEST(Map, InsertFind) {
+    EDF::Map<uint32_t, int, 8> map;
+    map.insert( 10, 100 );
+    map.insert( 20, 200 );
+    EXPECT_EQ( map.length(), 2 );
+    ASSERT_NE( map.find( 10 ), nullptr );
+    EXPECT_EQ( *map.find( 10 ), 100 );
+    EXPECT_EQ( map.at( 20 ), 200 );
+    EXPECT_TRUE( map.contains( 20 ) );
+    EXPECT_FALSE( map.contains( 30 ) );
+
+    // Inserting an existing key replaces its value
+    map.insert( 10, 101 );
+    EXPECT_EQ( map.length(), 2 );
+    EXPECT_EQ( map.at( 10 ), 101 );
+
+    const auto& constMap = map;
+    EXPECT_EQ( *constMap.find( 20 ), 200 );
+    EXPECT_EQ( constMap.find( 30 ), nullptr );
+    EXPECT_DEATH( map.at( 30 ), "" );
+}
+
+TEST(Map, Full) {
+    EDF::Map<uint32_t, uint32_t, 4> map;
+    for( uint32_t k = 0; k < 4; ++k ) {
+        map.insert( k, k );
+    }
+    EXPECT_TRUE( map.isFull() );
+    // Replacing an existing key still works when full
+    map.insert( 2, 20 );
+    EXPECT_EQ( map.at( 2 ), 20 );
+    EXPECT_DEATH( map.insert( 4, 4 ), "" );
+}
+
+TEST(Map, Emplace) {
+    Counted::alive = 0;
+    {
+        EDF::Map<uint32_t, Counted, 4> map;
+        EXPECT_EQ( map.emplace( 1, 10 ).getValue(), 10 );
+        EXPECT_EQ( Counted::alive, 1 );
+        // Existing key, args aren't used and nothing is constructed
+        EXPECT_EQ( map.emplace( 1, 99 ).getValue(), 10 );
+        EXPECT_EQ( Counted::alive, 1 );
+        map.emplace( 2, 20 );
+        map.emplace( 3, 30 );
+        EXPECT_EQ( Counted::alive, 3 );
+        EXPECT_TRUE( map.erase( 2 ) );
+        EXPECT_EQ( Counted::alive, 2 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(Map, MoveOnlyValue) {
+    EDF::Map<uint32_t, std::unique_ptr<int>, 4> map;
+    map.insert( 1, std::make_unique<int>( 5 ) );
+    map.emplace( 2, new int( 6 ) );
+    EXPECT_EQ( *map.at( 1 ), 5 );
+    EXPECT_EQ( *map.at( 2 ), 6 );
+}
+
+TEST(Map, Erase) {
+    EDF::Map<uint32_t, int, 8> map;
+    map.insert( 1, 1 );
+    map.insert( 2, 2 );
+    map.insert( 3, 3 );
+    EXPECT_TRUE( map.erase( 2 ) );
+    EXPECT_FALSE( map.erase( 2 ) );
+    EXPECT_EQ( map.length(), 2 );
+    EXPECT_FALSE( map.contains( 2 ) );
+    EXPECT_TRUE( map.contains( 1 ) );
+    EXPECT_TRUE( map.contains( 3 ) );
+
+    map.clear();
+    EXPECT_TRUE( map.isEmpty() );
+    EXPECT_FALSE( map.contains( 1 ) );
+}
+
+TEST(Map, Collisions) {
+    EDF::Map<uint32_t, uint32_t, 12, CollidingHash> map;
+    for( uint32_t k = 0; k < 12; ++k ) {
+        map.insert( k, k * 10 );
+    }
+    for( uint32_t k = 0; k < 12; ++k ) {
+        ASSERT_NE( map.find( k ), nullptr );
+        EXPECT_EQ( *map.find( k ), k * 10 );
+    }
+    EXPECT_FALSE( map.contains( 12 ) );
+
+    // Erasing from the middle of the probe sequence keeps the rest reachable
+    EXPECT_TRUE( map.erase( 0 ) );
+    EXPECT_TRUE( map.erase( 5 ) );
+    for( uint32_t k = 1; k < 12; ++k ) {
+        EXPECT_EQ( map.contains( k ), k != 5 );
+    }
+}
+
+// The value can belong to an entry that placing the new key shifts along, it must be read before the shift
+TEST(Map, InsertValueOfAnotherEntry) {
+    for( uint32_t k2 = 100; k2 < 140; ++k2 ) {
+        for( uint32_t k1 = 0; k1 < 10; ++k1 ) {
+            EDF::Map<uint32_t, uint32_t, 12> map;
+            for( uint32_t k = 0; k < 10; ++k ) {
+                map.insert( k, k * 10 + 1 );
+            }
+            map.insert( k2, map.at( k1 ) );
+            ASSERT_NE( map.find( k2 ), nullptr );
+            EXPECT_EQ( *map.find( k2 ), k1 * 10 + 1 );
+            EXPECT_EQ( map.at( k1 ), k1 * 10 + 1 );
+        }
+    }
+}
+
+TEST(Map, StringKeys) {
+    EDF::Map<EDF::String<16>, int, 8> commands;
+    commands.insert( "reset", 1 );
+    commands.insert( "status", 2 );
+    commands.emplace( EDF::String<16>( "version" ), 3 );
+    EXPECT_EQ( commands.at( "reset" ), 1 );
+    EXPECT_EQ( commands.at( "status" ), 2 );
+    EXPECT_EQ( commands.at( "version" ), 3 );
+    EXPECT_FALSE( commands.contains( "rese" ) );
+    EXPECT_FALSE( commands.contains( "" ) );
+}
+
+TEST(Map, Iterate) {
+    EDF::Map<uint32_t, uint32_t, 16> map;
+    uint32_t expectedSum = 0;
+    for( uint32_t k = 1; k <= 10; ++k ) {
+        map.insert( k * 7, k );
+        expectedSum += k;
+    }
+    uint32_t sum = 0;
+    std::size_t count = 0;
+    for( auto& entry : map ) {
+        EXPECT_EQ( entry.key, entry.value * 7 );
+        sum += entry.value;
+        ++count;
+    }
+    EXPECT_EQ( count, 10 );
+    EXPECT_EQ( sum, expectedSum );
+}
+
+TEST(Map, MatchesStdMap) {
+    constexpr std::size_t N = 100;
+    EDF::Map<uint32_t, uint32_t, N> map;
+    std::map<uint32_t, uint32_t> reference;
+    std::mt19937 random( 1234 );
+    for( int k = 0; k < 20000; ++k ) {
+        const auto key = static_cast<uint32_t>(random() % 200);
+        if( (random() % 2 == 0) && (reference.size() < N || reference.count( key ) != 0) ) {
+            map.insert( key, static_cast<uint32_t>(k) );
+            reference[key] = static_cast<uint32_t>(k);
+        }
+        else {
+            EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+        }
+        ASSERT_EQ( map.length(), reference.size() );
+    }
+    for( uint32_t key = 0; key < 200; ++key ) {
+        const auto it = reference.find( key );
+        if( it == reference.end() ) {
+            EXPECT_EQ( map.find( key ), nullptr );
+        }
+        else {
+            ASSERT_NE( map.find( key ), nullptr );
+            EXPECT_EQ( *map.find( key ), it->second );
+        }
+    }
+}
@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+
 TEST(Math, NumberOfElements) {
 #define ARRAY_SIZE (10)
     unsigned char array[ARRAY_SIZE];
@@ -34,6 +36,33 @@ TEST(Math, IsPowerOfTwo) {
     EXPECT_FALSE( EDF::isPow2( 1234567890 ) );
 }
 
+TEST(Math, BitWidth) {
+    EXPECT_EQ( EDF::bitWidth( 0u ), 0 );
+    EXPECT_EQ( EDF::bitWidth( 1u ), 1 );
+    EXPECT_EQ( EDF::bitWidth( 5u ), 3 );
+    EXPECT_EQ( EDF::bitWidth( static_cast<std::uint8_t>(255) ), 8 );
+    EXPECT_EQ( EDF::bitWidth( 0x80000000u ), 32 );
+    EXPECT_EQ( EDF::bitWidth( ~0ull ), 64 );
+    static_assert( EDF::bitWidth( 1024u ) == 11 );
+}
+
+TEST(Math, CountTrailingZeros) {
+    EXPECT_EQ( EDF::countTrailingZeros( 1u ), 0 );
+    EXPECT_EQ( EDF::countTrailingZeros( 8u ), 3 );
+    EXPECT_EQ( EDF::countTrailingZeros( 0x80000000u ), 31 );
+    EXPECT_EQ( EDF::countTrailingZeros( 1ull << 63 ), 63 );
+    static_assert( EDF::countTrailingZeros( 12u ) == 2 );
+}
+
+TEST(Math, CountSetBits) {
+    EXPECT_EQ( EDF::countSetBits( 0u ), 0 );
+    EXPECT_EQ( EDF::countSetBits( 0xF0u ), 4 );
+    EXPECT_EQ( EDF::countSetBits( static_cast<std::uint8_t>(255) ), 8 );
+    EXPECT_EQ( EDF::countSetBits( 0x8000000000000001ull ), 2 );
+    EXPECT_EQ( EDF::countSetBits( ~0ull ), 64 );
+    static_assert( EDF::countSetBits( 0x12345678u ) == 13 );
+}
+
 TEST(Math, Minimum) {
     EXPECT_EQ( EDF::min( 0, 0 ), 0 );
     EXPECT_EQ( EDF::min( 0, 1 ), 0 );
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/OverwriteQueue.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(OverwriteQueue, Initialization) {
+    EDF::OverwriteQueue<int, 8> queue;
+    EXPECT_EQ( queue.maxLength(), 8 );
+    EXPECT_EQ( queue.length(), 0 );
+    EXPECT_EQ( queue.overwritten(), 0 );
+
+    EDF::OverwriteQueue<int, 4> queueIList = { 1, 2, 3, 4 };
+    EXPECT_TRUE( queueIList.isFull() );
+    EXPECT_EQ( queueIList.peek(), 1 );
+    EXPECT_EQ( queueIList.latest(), 4 );
+}
+
+TEST(OverwriteQueue, PushOverwritesOldest) {
+    EDF::OverwriteQueue<int, 4> queuePow2;
+    EDF::OverwriteQueue<int, 5> queueNotPow2;
+    for( int k = 0; k < 23; ++k ) {
+        queuePow2.push( k );
+        queueNotPow2.push( k );
+    }
+    EXPECT_TRUE( queuePow2.isFull() );
+    EXPECT_EQ( queuePow2.overwritten(), 19 );
+    EXPECT_EQ( queueNotPow2.overwritten(), 18 );
+
+    for( int k = 19; k < 23; ++k ) {
+        EXPECT_EQ( queuePow2.pop(), k );
+    }
+    for( int k = 18; k < 23; ++k ) {
+        EXPECT_EQ( queueNotPow2.pop(), k );
+    }
+    EXPECT_TRUE( queuePow2.isEmpty() );
+    EXPECT_DEATH( queuePow2.pop(), "" );
+}
+
+TEST(OverwriteQueue, Latest) {
+    EDF::OverwriteQueue<int, 6> queue;
+    queue.push( 1 );
+    EXPECT_EQ( queue.latest(), 1 );
+    EXPECT_DEATH( queue.latest( 1 ), "" );
+
+    for( int k = 2; k <= 10; ++k ) {
+        queue.push( k );
+    }
+    for( std::size_t k = 0; k < queue.length(); ++k ) {
+        EXPECT_EQ( queue.latest( k ), 10 - static_cast<int>(k) );
+        EXPECT_EQ( queue.at( k ), 5 + static_cast<int>(k) );
+    }
+    EXPECT_DEATH( queue.at( 6 ), "" );
+}
+
+TEST(OverwriteQueue, WindowedAverage) {
+    EDF::OverwriteQueue<int, 4> window;
+    int sum = 0;
+    for( int sample = 1; sample <= 10; ++sample ) {
+        if( window.isFull() ) {
+            sum -= window.peek();
+        }
+        window.push( sample );
+        sum += sample;
+    }
+    EXPECT_EQ( sum, 7 + 8 + 9 + 10 );
+}
+
+TEST(OverwriteQueue, EmplaceClear) {
+    struct Pair { int a; int b; Pair( int x = 0, int y = 0 ) : a(x), b(y) {} };
+    EDF::OverwriteQueue<Pair, 2> queue;
+    queue.emplace( 1, 2 );
+    queue.emplace( 3, 4 );
+    auto& value = queue.emplace( 5, 6 );
+    EXPECT_EQ( value.a, 5 );
+    EXPECT_EQ( queue.peek().a, 3 );
+    EXPECT_EQ( queue.overwritten(), 1 );
+
+    queue.clear();
+    EXPECT_TRUE( queue.isEmpty() );
+    EXPECT_EQ( queue.overwritten(), 0 );
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+class Counted {
+private:
+    int variable;
+public:
+    static inline int alive = 0;
+    explicit Counted( int initialValue ) : variable(initialValue) { ++alive; }
+    ~Counted() { --alive; }
+    int getValue() const { return variable; }
+};
+static_assert( !std::is_default_constructible_v<Counted> );
+} /* anonymous */
+
+TEST(Pool, Initialization) {
+    EDF::Pool<int, 8> pool;
+    EXPECT_TRUE( pool.isEmpty() );
+    EXPECT_FALSE( pool.isFull() );
+    EXPECT_EQ( pool.length(), 0 );
+    EXPECT_EQ( pool.maxLength(), 8 );
+    EXPECT_EQ( pool.highWaterMark(), 0 );
+}
+
+TEST(Pool, AllocateUntilFull) {
+    EDF::Pool<std::uint32_t, 4> pool;
+    std::uint32_t* pointers[4] = {};
+    for( auto& pointer : pointers ) {
+        pointer = pool.allocate();
+        ASSERT_NE( pointer, nullptr );
+        EXPECT_TRUE( pool.owns( pointer ) );
+    }
+    EXPECT_TRUE( pool.isFull() );
+    EXPECT_EQ( pool.allocate(), nullptr );
+
+    // Every slot is distinct
+    for( std::size_t k = 0; k < 4; ++k ) {
+        *pointers[k] = static_cast<std::uint32_t>(k);
+    }
+    for( std::size_t k = 0; k < 4; ++k ) {
+        EXPECT_EQ( *pointers[k], k );
+    }
+
+    pool.deallocate( pointers[2] );
+    EXPECT_FALSE( pool.isFull() );
+    EXPECT_EQ( pool.allocate(), pointers[2] );
+}
+
+TEST(Pool, ReusesMostRecentlyFreed) {
+    EDF::Pool<std::uint64_t, 8> pool;
+    std::uint64_t* a = pool.allocate();
+    std::uint64_t* b = pool.allocate();
+    std::uint64_t* c = pool.allocate();
+    pool.deallocate( a );
+    pool.deallocate( c );
+    EXPECT_EQ( pool.allocate(), c );
+    EXPECT_EQ( pool.allocate(), a );
+    EXPECT_NE( pool.allocate(), b );
+    EXPECT_EQ( pool.length(), 4 );
+}
+
+TEST(Pool, Owns) {
+    EDF::Pool<std::uint32_t, 4> pool;
+    std::uint32_t outside = 0;
+    std::uint32_t* inside = pool.allocate();
+    EXPECT_TRUE( pool.owns( inside ) );
+    EXPECT_FALSE( pool.owns( &outside ) );
+    EXPECT_FALSE( pool.owns( reinterpret_cast<std::uint32_t*>(reinterpret_cast<std::uint8_t*>(inside) + 1) ) );
+}
+
+TEST(Pool, ConstructDestroy) {
+    Counted::alive = 0;
+    EDF::Pool<Counted, 4> pool;
+    EXPECT_EQ( Counted::alive, 0 );
+
+    Counted* first = pool.construct( 1 );
+    Counted* second = pool.construct( 2 );
+    ASSERT_NE( first, nullptr );
+    ASSERT_NE( second, nullptr );
+    EXPECT_EQ( Counted::alive, 2 );
+    EXPECT_EQ( first->getValue(), 1 );
+    EXPECT_EQ( second->getValue(), 2 );
+
+    pool.destroy( first );
+    EXPECT_EQ( Counted::alive, 1 );
+    EXPECT_EQ( pool.length(), 1 );
+    pool.destroy( nullptr );
+    pool.destroy( second );
+    EXPECT_EQ( Counted::alive, 0 );
+    EXPECT_TRUE( pool.isEmpty() );
+}
+
+TEST(Pool, Alignment) {
+    struct alignas(16) Wide {
+        std::uint8_t bytes[24];
+    };
+    EDF::Pool<Wide, 4> pool;
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_EQ( reinterpret_cast<std::uintptr_t>(pool.allocate()) % alignof(Wide), 0u );
+    }
+}
+
+TEST(Pool, HighWaterMark) {
+    EDF::Pool<int, 8> pool;
+    int* pointers[5] = {};
+    for( auto& pointer : pointers ) {
+        pointer = pool.allocate();
+    }
+    for( auto& pointer : pointers ) {
+        pool.deallocate( pointer );
+    }
+    pool.allocate();
+    EXPECT_EQ( pool.length(), 1 );
+    EXPECT_EQ( pool.highWaterMark(), 5 );
+
+    pool.resetHighWaterMark();
+    EXPECT_EQ( pool.highWaterMark(), 1 );
+}
+
+TEST(AtomicPool, AllocateUntilFull) {
+    EDF::AtomicPool<std::uint32_t, 4> pool;
+    EXPECT_TRUE( pool.isEmpty() );
+    std::uint32_t* pointers[4] = {};
+    for( auto& pointer : pointers ) {
+        pointer = pool.allocate();
+        ASSERT_NE( pointer, nullptr );
+        EXPECT_TRUE( pool.owns( pointer ) );
+    }
+    EXPECT_TRUE( pool.isFull() );
+    EXPECT_EQ( pool.allocate(), nullptr );
+
+    pool.deallocate( pointers[1] );
+    pool.deallocate( pointers[3] );
+    EXPECT_EQ( pool.allocate(), pointers[3] );
+    EXPECT_EQ( pool.allocate(), pointers[1] );
+    EXPECT_EQ( pool.highWaterMark(), 4 );
+}
+
+TEST(AtomicPool, ConstructDestroy) {
+    Counted::alive = 0;
+    EDF::AtomicPool<Counted, 4> pool;
+    Counted* counted = pool.construct( 7 );
+    ASSERT_NE( counted, nullptr );
+    EXPECT_EQ( counted->getValue(), 7 );
+    EXPECT_EQ( Counted::alive, 1 );
+    pool.destroy( counted );
+    EXPECT_EQ( Counted::alive, 0 );
+    EXPECT_TRUE( pool.isEmpty() );
+}
+
+TEST(AtomicPool, ThreadsNeverShareASlot) {
+    struct Block {
+        std::uint32_t owner;
+        std::uint32_t sequence;
+    };
+    constexpr int THREADS = 4;
+    constexpr std::uint32_t ITERATIONS = 20000;
+    EDF::AtomicPool<Block, 16> pool;
+    std::atomic<bool> failed{ false };
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREADS; ++t ) {
+        threads.emplace_back( [&pool, &failed, t](){
+            const auto owner = static_cast<std::uint32_t>(t);
+            for( std::uint32_t k = 0; k < ITERATIONS; ++k ) {
+                Block* block = pool.construct( Block{ owner, k } );
+                if( block == nullptr ) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::this_thread::yield();
+                if( (block->owner != owner) || (block->sequence != k) ) {
+                    failed = true;
+                }
+                pool.destroy( block );
+            }
+        } );
+    }
+    for( auto& thread : threads ) {
+        thread.join();
+    }
+    EXPECT_FALSE( failed );
+    EXPECT_TRUE( pool.isEmpty() );
+    EXPECT_LE( pool.highWaterMark(), static_cast<std::size_t>(THREADS) );
+}
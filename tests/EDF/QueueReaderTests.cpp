@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/QueueReader.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+struct Header {
+    uint8_t id;
+    uint16_t length;
+};
+
+struct Packet {
+    Header header;
+    float temperature;
+    int16_t samples[3];
+    EDF::Array<uint32_t, 2> timestamps;
+};
+
+using HeaderLayout = EDF::Layout<Header,
+    EDF::Field<&Header::id>,
+    EDF::Field<&Header::length, EDF::Endian::little>
+>;
+
+using PacketLayout = EDF::Layout<Packet,
+    EDF::Nested<&Packet::header, HeaderLayout>,
+    EDF::Padding<1>,
+    EDF::Field<&Packet::temperature>,
+    EDF::Field<&Packet::samples, EDF::Endian::little>,
+    EDF::Field<&Packet::timestamps>
+>;
+
+constexpr uint8_t packetBytes[] = {
+    0x07, 0x34, 0x12,               // header
+    0xFF,                           // padding
+    0x3F, 0xC0, 0x00, 0x00,         // 1.5f
+    0x01, 0x00, 0xFF, 0xFF, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0xDE, 0xAD, 0xBE, 0xEF,
+};
+
+template<std::size_t N, EDF::QueueMode M>
+void pushBytes( EDF::Queue<uint8_t, N, M>& queue, const uint8_t* bytes, std::size_t count ) {
+    queue.push( bytes, count );
+}
+
+void expectPacket( const Packet& packet ) {
+    EXPECT_EQ( packet.header.id, 0x07 );
+    EXPECT_EQ( packet.header.length, 0x1234 );
+    EXPECT_EQ( packet.temperature, 1.5f );
+    EXPECT_EQ( packet.samples[0], 1 );
+    EXPECT_EQ( packet.samples[1], -1 );
+    EXPECT_EQ( packet.samples[2], INT16_MIN );
+    EXPECT_EQ( packet.timestamps[0], 1u );
+    EXPECT_EQ( packet.timestamps[1], 0xDEADBEEFu );
+}
+} /* namespace */
+
+TEST(QueueReader, LayoutSize) {
+    static_assert( HeaderLayout::SIZE == 3 );
+    static_assert( PacketLayout::SIZE == sizeof(packetBytes) );
+}
+
+TEST(QueueReader, ReadLayout) {
+    EDF::Queue<uint8_t, 64> queue;
+    pushBytes( queue, packetBytes, sizeof(packetBytes) );
+
+    EDF::QueueReader reader( queue );
+    Packet packet{};
+    EXPECT_TRUE( reader.read<PacketLayout>( packet ) );
+    expectPacket( packet );
+    EXPECT_EQ( reader.consumed(), sizeof(packetBytes) );
+    EXPECT_EQ( queue.length(), sizeof(packetBytes) );   // nothing removed until commit()
+
+    reader.commit();
+    EXPECT_TRUE( queue.isEmpty() );
+    EXPECT_EQ( reader.available(), 0 );
+}
+
+TEST(QueueReader, ReadLayoutWrapped) {
+    // walk the start of the frame across every wrap position, including inside multi-byte fields
+    for( std::size_t start = 0; start < 32; ++start ) {
+        EDF::Queue<uint8_t, 32> queue;
+        queue.commitPush( start );
+        queue.commitPop( start );
+        pushBytes( queue, packetBytes, sizeof(packetBytes) );
+
+        EDF::QueueReader reader( queue );
+        Packet packet{};
+        EXPECT_TRUE( reader.read<PacketLayout>( packet ) );
+        expectPacket( packet );
+        reader.commit();
+        EXPECT_TRUE( queue.isEmpty() );
+    }
+}
+
+TEST(QueueReader, ReadLayoutFreeRunning) {
+    for( std::size_t start = 0; start < 32; ++start ) {
+        EDF::QueueFreeRunning<uint8_t, 32> queue;
+        queue.commitPush( start );
+        queue.commitPop( start );
+        pushBytes( queue, packetBytes, sizeof(packetBytes) );
+
+        EDF::QueueReader reader( queue );
+        Packet packet{};
+        EXPECT_TRUE( reader.read<PacketLayout>( packet ) );
+        expectPacket( packet );
+        reader.commit();
+        EXPECT_TRUE( queue.isEmpty() );
+    }
+}
+
+TEST(QueueReader, PartialFrame) {
+    EDF::Queue<uint8_t, 64> queue;
+    pushBytes( queue, packetBytes, 10 );
+
+    EDF::QueueReader reader( queue );
+    Packet packet{};
+    EXPECT_FALSE( reader.read<PacketLayout>( packet ) );
+    EXPECT_EQ( reader.consumed(), 0 );
+
+    pushBytes( queue, packetBytes + 10, sizeof(packetBytes) - 10 );
+    reader.refresh();
+    EXPECT_TRUE( reader.read<PacketLayout>( packet ) );
+    expectPacket( packet );
+}
+
+TEST(QueueReader, ReadValues) {
+    EDF::Queue<uint8_t, 8> queue;
+    queue.commitPush( 6 );
+    queue.commitPop( 6 );
+    const uint8_t bytes[] = { 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0xAA };
+    pushBytes( queue, bytes, sizeof(bytes) );
+
+    EDF::QueueReader reader( queue );
+    EXPECT_EQ( reader.read<uint16_t>(), 0x1234 );
+    EXPECT_EQ( (reader.read<uint32_t, EDF::Endian::little>()), 0x12345678u );
+    EXPECT_EQ( reader.available(), 1 );
+    EXPECT_DEATH( reader.read<uint16_t>(), "" );
+
+    reader.rewind();
+    reader.skip( 2 );
+    EXPECT_EQ( (reader.read<uint16_t, EDF::Endian::little>()), 0x5678 );
+    reader.commit();
+    EXPECT_EQ( queue.length(), 3 );
+    EXPECT_EQ( queue.pop16be(), 0x3412 );
+}
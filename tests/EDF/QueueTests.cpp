@@ -174,6 +174,99 @@ TEST(Queue, Clear) {
     EXPECT_EQ( queue.length(), 0 );
 }
 
+TEST(Queue, LengthNotPow2Wrapped) {
+    EDF::Queue<int, 5> queue = { 1, 2, 3, 4 };
+    queue.pop();
+    queue.pop();
+    queue.pop();
+    queue.push( 5 );
+    queue.push( 6 );    // tail wraps around behind head
+    EXPECT_EQ( queue.length(), 3 );
+    EXPECT_EQ( queue.pop(), 4 );
+    EXPECT_EQ( queue.pop(), 5 );
+    EXPECT_EQ( queue.pop(), 6 );
+}
+
+TEST(Queue, PushPopBulk) {
+    const int data[] = { 1, 2, 3, 4, 5, 6 };
+    int out[6] = {};
+
+    EDF::Queue<int, 8> queuePow2;
+    EDF::Queue<int, 7> queueNotPow2;
+    for( int k = 0; k < 5; ++k ) {  // walk head and tail around so the block moves wrap
+        queuePow2.push( data, 5 );
+        EXPECT_EQ( queuePow2.length(), 5 );
+        queuePow2.pop( out, 5 );
+        EXPECT_TRUE( std::equal( data, data + 5, out ) );
+
+        queueNotPow2.push( data, 6 );
+        EXPECT_TRUE( queueNotPow2.isFull() );
+        queueNotPow2.pop( out, 6 );
+        EXPECT_TRUE( std::equal( data, data + 6, out ) );
+        EXPECT_TRUE( queueNotPow2.isEmpty() );
+    }
+
+    queuePow2.push( data, 6 );
+    EXPECT_DEATH( queuePow2.push( data, 2 ), "" );
+    EXPECT_DEATH( queuePow2.pop( out, 7 ), "" );
+}
+
+TEST(Queue, ReadableSpans) {
+    EDF::Queue<int, 8> queue;
+    auto spans = queue.readableSpans();
+    EXPECT_TRUE( spans[0].isEmpty() );
+    EXPECT_TRUE( spans[1].isEmpty() );
+
+    const int data[] = { 1, 2, 3, 4, 5, 6 };
+    queue.push( data, 6 );
+    queue.commitPop( 4 );
+    queue.push( data, 4 );          // tail wraps to index 2
+    spans = queue.readableSpans();
+    EXPECT_EQ( spans[0].length(), 4 );
+    EXPECT_EQ( spans[1].length(), 2 );
+    EXPECT_EQ( spans[0][0], 5 );
+    EXPECT_EQ( spans[0][1], 6 );
+    EXPECT_EQ( spans[0][2], 1 );
+    EXPECT_EQ( spans[1][0], 3 );
+    EXPECT_EQ( spans[1][1], 4 );
+
+    std::size_t total = 0;
+    for( auto&& span : spans ) {
+        total += span.length();
+    }
+    EXPECT_EQ( total, queue.length() );
+
+    queue.commitPop( spans[0].length() );
+    EXPECT_EQ( queue.pop(), 3 );
+    EXPECT_DEATH( queue.commitPop( 2 ), "" );
+}
+
+TEST(Queue, WritableSpans) {
+    EDF::Queue<uint8_t, 8> queue;
+    auto spans = queue.writableSpans();
+    EXPECT_EQ( spans[0].length(), 7 );
+    EXPECT_TRUE( spans[1].isEmpty() );
+
+    queue.commitPush( 5 );
+    queue.commitPop( 5 );
+    spans = queue.writableSpans();  // head == tail == 5, free region wraps
+    EXPECT_EQ( spans[0].length(), 3 );
+    EXPECT_EQ( spans[1].length(), 4 );
+
+    uint8_t value = 0;
+    for( auto&& span : spans ) {
+        for( auto& element : span ) {
+            element = value++;
+        }
+    }
+    queue.commitPush( 7 );
+    EXPECT_TRUE( queue.isFull() );
+    for( uint8_t k = 0; k < 7; ++k ) {
+        EXPECT_EQ( queue.pop(), k );
+    }
+    EXPECT_DEATH( queue.commitPush( 8 ), "" );
+}
+
 /* uint8_t specialized member functions */
 
 TEST(Queue, PopBigEndian) {
@@ -208,4 +301,129 @@ TEST(Queue, PopLittleEndian) {
     EXPECT_EQ( queue.pop16le(), 0x1234 );
     EXPECT_EQ( queue.pop32le(), 0x12345678 );
     EXPECT_EQ( queue.pop64le(), 0x123456789ABCDEF0 );
+}
+
+TEST(Queue, PopWrapped) {
+    EDF::Queue<uint8_t, 8> queue;
+    for( std::size_t start = 0; start < 8; ++start ) {
+        queue.commitPush( start );
+        queue.commitPop( start );
+        const uint8_t bytes[] = { 0x12, 0x34, 0x56, 0x78 };
+        queue.push( bytes, 4 );
+        EXPECT_EQ( queue.pop32be(), 0x12345678 );
+        queue.push( bytes, 4 );
+        EXPECT_EQ( queue.pop32le(), 0x78563412 );
+    }
+    EXPECT_DEATH( queue.push64be( 0x0102030405060708 ), "" );  // 7 bytes max, never fits
+}
+
+TEST(Queue, PushBigEndian) {
+    EDF::Queue<uint8_t, 16> queue;
+    queue.push8be( 0x12 );
+    queue.push16be( 0x1234 );
+    queue.push32be( 0x12345678 );
+    queue.push64be( 0x123456789ABCDEF0 );
+    EXPECT_TRUE( queue.isFull() );
+    const uint8_t expected[] = {
+        0x12,
+        0x12, 0x34,
+        0x12, 0x34, 0x56, 0x78,
+        0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0,
+    };
+    for( auto&& byte : expected ) {
+        EXPECT_EQ( queue.pop(), byte );
+    }
+}
+
+TEST(Queue, PushLittleEndian) {
+    EDF::Queue<uint8_t, 16> queue;
+    queue.push8le( 0x12 );
+    queue.push16le( 0x1234 );
+    queue.push32le( 0x12345678 );
+    queue.push64le( 0x123456789ABCDEF0 );
+    EXPECT_DEATH( queue.push16le( 0 ), "" );
+    const uint8_t expected[] = {
+        0x12,
+        0x34, 0x12,
+        0x78, 0x56, 0x34, 0x12,
+        0xF0, 0xDE, 0xBC, 0x9A, 0x78, 0x56, 0x34, 0x12,
+    };
+    for( auto&& byte : expected ) {
+        EXPECT_EQ( queue.pop(), byte );
+    }
+}
+
+TEST(Queue, PushWrapped) {
+    EDF::Queue<uint8_t, 8> queue;
+    for( std::size_t start = 0; start < 8; ++start ) {
+        queue.commitPush( start );
+        queue.commitPop( start );
+        queue.push32be( 0x12345678 );
+        EXPECT_EQ( queue.pop32le(), 0x78563412 );
+    }
+    EXPECT_DEATH( queue.push64be( 0x0102030405060708 ), "" );  // 7 bytes max, never fits
+}
+
+/* QueueMode::freeRunning */
+
+TEST(QueueFreeRunning, UsesAllSlots) {
+    EDF::QueueFreeRunning<uint8_t, 256> queueBytes;
+    EXPECT_EQ( queueBytes.maxLength(), 256 );
+
+    EDF::QueueFreeRunning<CustomClass, 4> queue;
+    EXPECT_EQ( queue.maxLength(), 4 );
+    EXPECT_TRUE( queue.isEmpty() );
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_FALSE( queue.isFull() );
+        queue.push( k );
+        EXPECT_EQ( queue.length(), static_cast<std::size_t>(k + 1) );
+    }
+    EXPECT_TRUE( queue.isFull() );
+    EXPECT_DEATH( queue.push( 4 ), "" );
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_EQ( queue.pop().getValue(), k );
+    }
+    EXPECT_TRUE( queue.isEmpty() );
+    EXPECT_DEATH( queue.pop(), "" );
+}
+
+TEST(QueueFreeRunning, Wrap) {
+    EDF::QueueFreeRunning<int, 8> queue;
+    for( int k = 0; k < 100; ++k ) {
+        queue.push( k );
+        queue.push( k + 1000 );
+        EXPECT_EQ( queue.peek(), k );
+        EXPECT_EQ( queue.pop(), k );
+        EXPECT_EQ( queue.pop(), k + 1000 );
+    }
+
+    const int data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    int out[8] = {};
+    queue.push( data, 8 );
+    EXPECT_TRUE( queue.isFull() );
+    auto spans = queue.readableSpans();
+    EXPECT_EQ( spans[0].length() + spans[1].length(), 8 );
+    EXPECT_TRUE( queue.writableSpans()[0].isEmpty() );
+    queue.pop( out, 8 );
+    EXPECT_TRUE( std::equal( data, data + 8, out ) );
+}
+
+TEST(QueueFreeRunning, Emplace) {
+    EDF::QueueFreeRunning<CustomClass, 2> queue;
+    auto& value = queue.emplace( 7 );
+    EXPECT_EQ( value.getValue(), 7 );
+    queue.emplace( 8 );
+    EXPECT_TRUE( queue.isFull() );
+    EXPECT_EQ( queue.pop().getValue(), 7 );
+}
+
+TEST(QueueFreeRunning, BytesWrapped) {
+    EDF::QueueFreeRunning<uint8_t, 8> queue;
+    for( std::size_t start = 0; start < 8; ++start ) {
+        queue.commitPush( start );
+        queue.commitPop( start );
+        queue.push64be( 0x0102030405060708 );   // all 8 slots
+        EXPECT_TRUE( queue.isFull() );
+        EXPECT_EQ( queue.pop64le(), 0x0807060504030201 );
+    }
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/QueueWriter.hpp>
+#include <EDF/QueueReader.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+struct Reading {
+    uint8_t channel;
+    int32_t value;
+    double scale;
+};
+
+struct Report {
+    uint16_t sequence;
+    Reading readings[2];
+};
+
+using ReadingLayout = EDF::Layout<Reading,
+    EDF::Field<&Reading::channel>,
+    EDF::Padding<3>,
+    EDF::Field<&Reading::value, EDF::Endian::little>,
+    EDF::Field<&Reading::scale>
+>;
+
+using ReportLayout = EDF::Layout<Report,
+    EDF::Field<&Report::sequence>,
+    EDF::Nested<&Report::readings, ReadingLayout>
+>;
+
+const Report report = { 0xA55A, { { 1, -100, 0.5 }, { 2, 123456, -4.0 } } };
+const uint8_t reportBytes[] = {
+    0xA5, 0x5A,
+    0x01, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x40, 0xE2, 0x01, 0x00, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+} /* namespace */
+
+TEST(QueueWriter, LayoutSize) {
+    static_assert( ReportLayout::SIZE == sizeof(reportBytes) );
+}
+
+TEST(QueueWriter, WriteLayout) {
+    for( std::size_t start = 0; start < 64; ++start ) {  // every wrap position
+        EDF::Queue<uint8_t, 64> queue;
+        queue.commitPush( start );
+        queue.commitPop( start );
+
+        EDF::QueueWriter writer( queue );
+        EXPECT_TRUE( writer.write<ReportLayout>( report ) );
+        EXPECT_EQ( writer.written(), sizeof(reportBytes) );
+        EXPECT_TRUE( queue.isEmpty() );  // nothing added until commit()
+
+        writer.commit();
+        ASSERT_EQ( queue.length(), sizeof(reportBytes) );
+        uint8_t bytes[sizeof(reportBytes)] = {};
+        queue.pop( bytes, sizeof(bytes) );
+        EXPECT_TRUE( std::equal( bytes, bytes + sizeof(bytes), reportBytes ) );
+    }
+}
+
+TEST(QueueWriter, RoundTrip) {
+    EDF::Queue<uint8_t, 128> queue;
+    queue.commitPush( 100 );
+    queue.commitPop( 100 );
+
+    EDF::QueueWriter writer( queue );
+    EXPECT_TRUE( writer.write<ReportLayout>( report ) );
+    EXPECT_TRUE( writer.write<ReportLayout>( report ) );
+    writer.commit();
+
+    EDF::QueueReader reader( queue );
+    for( int k = 0; k < 2; ++k ) {
+        Report decoded{};
+        EXPECT_TRUE( reader.read<ReportLayout>( decoded ) );
+        EXPECT_EQ( decoded.sequence, report.sequence );
+        for( std::size_t r = 0; r < 2; ++r ) {
+            EXPECT_EQ( decoded.readings[r].channel, report.readings[r].channel );
+            EXPECT_EQ( decoded.readings[r].value, report.readings[r].value );
+            EXPECT_EQ( decoded.readings[r].scale, report.readings[r].scale );
+        }
+    }
+    reader.commit();
+    EXPECT_TRUE( queue.isEmpty() );
+}
+
+TEST(QueueWriter, NoRoom) {
+    EDF::Queue<uint8_t, 32> queue;
+    EDF::QueueWriter writer( queue );
+    EXPECT_FALSE( writer.write<ReportLayout>( report ) );
+    EXPECT_EQ( writer.written(), 0 );
+    EXPECT_EQ( writer.available(), 31 );
+}
+
+TEST(QueueWriter, WriteValues) {
+    EDF::Queue<uint8_t, 8> queue;
+    EDF::QueueWriter writer( queue );
+    writer.write( static_cast<uint16_t>(0x1234) );
+    writer.write<uint32_t, EDF::Endian::little>( 0x12345678 );
+    EXPECT_EQ( writer.available(), 1 );
+    EXPECT_DEATH( writer.write( static_cast<uint16_t>(0) ), "" );
+
+    writer.rewind();
+    writer.write<uint32_t, EDF::Endian::little>( 0x12345678 );
+    writer.commit();
+    EXPECT_EQ( queue.pop32le(), 0x12345678 );
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/RadixHeap.hpp>
+#include <EDF/Heap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+TEST(RadixHeap, Initialization) {
+    EDF::RadixHeap<std::uint32_t, 32> heap;
+    EXPECT_EQ( heap.maxLength(), 32 );
+    EXPECT_EQ( heap.length(), 0 );
+    EXPECT_TRUE( heap.isEmpty() );
+    EXPECT_FALSE( heap.isFull() );
+    EXPECT_EQ( heap.lastKey(), 0 );
+}
+
+TEST(RadixHeap, PushPop) {
+    EDF::RadixHeap<std::uint32_t, 8> heap;
+    heap.push( 50 );
+    heap.push( 7 );
+    heap.push( 1000 );
+    heap.push( 7 );
+    heap.push( 0 );
+    EXPECT_EQ( heap.length(), 5 );
+    EXPECT_EQ( heap.peek(), 0 );
+
+    EXPECT_EQ( heap.pop(), 0 );
+    EXPECT_EQ( heap.peek(), 7 );
+    EXPECT_EQ( heap.pop(), 7 );
+    EXPECT_EQ( heap.pop(), 7 );
+    EXPECT_EQ( heap.lastKey(), 7 );
+
+    // Keys >= the last popped key may still be pushed, even if smaller than what's left
+    heap.push( 8 );
+    EXPECT_EQ( heap.pop(), 8 );
+    EXPECT_EQ( heap.pop(), 50 );
+    EXPECT_EQ( heap.pop(), 1000 );
+    EXPECT_TRUE( heap.isEmpty() );
+    EXPECT_DEATH( heap.pop(), "" );
+    EXPECT_DEATH( heap.push( 999 ), "" );
+}
+
+TEST(RadixHeap, IsFull) {
+    EDF::RadixHeap<std::uint16_t, 3> heap;
+    heap.push( 3 );
+    heap.push( 2 );
+    heap.push( 1 );
+    EXPECT_TRUE( heap.isFull() );
+    EXPECT_DEATH( heap.push( 4 ), "" );
+
+    EXPECT_EQ( heap.pop(), 1 );
+    heap.push( 4 );
+    EXPECT_EQ( heap.pop(), 2 );
+    EXPECT_EQ( heap.pop(), 3 );
+    EXPECT_EQ( heap.pop(), 4 );
+
+    heap.clear();
+    EXPECT_TRUE( heap.isEmpty() );
+    EXPECT_EQ( heap.lastKey(), 0 );
+    heap.push( 0 );
+    EXPECT_EQ( heap.pop(), 0 );
+}
+
+TEST(RadixHeap, Payload) {
+    struct Timer {
+        std::uint64_t deadline;
+        int id;
+        Timer( std::uint64_t d = 0, int i = 0 ) : deadline(d), id(i) {}
+    };
+    struct DeadlineOf {
+        std::uint64_t operator()( const Timer& timer ) const { return timer.deadline; }
+    };
+    EDF::RadixHeap<Timer, 4, DeadlineOf> timers;
+    timers.emplace( 1ull << 40, 1 );
+    timers.push( Timer( 5, 2 ) );
+    timers.emplace( ~0ull, 3 );
+    EXPECT_EQ( timers.peek().id, 2 );
+    EXPECT_EQ( timers.pop().id, 2 );
+    EXPECT_EQ( timers.pop().id, 1 );
+    EXPECT_EQ( timers.pop().id, 3 );
+    EXPECT_EQ( timers.lastKey(), ~0ull );
+}
+
+namespace {
+// Counts live objects, to check popped and cleared elements are destroyed
+class Tick {
+private:
+    std::uint32_t value;
+public:
+    static inline int alive = 0;
+    explicit Tick( std::uint32_t v ) : value(v) { ++alive; }
+    Tick( const Tick& other ) : value(other.value) { ++alive; }
+    Tick( Tick&& other ) : value(other.value) { ++alive; }
+    ~Tick() { --alive; }
+    std::uint32_t get() const { return value; }
+};
+struct TickOf {
+    std::uint32_t operator()( const Tick& tick ) const { return tick.get(); }
+};
+static_assert( !std::is_default_constructible_v<Tick> );
+} /* anonymous */
+
+TEST(RadixHeap, NotDefaultConstructible) {
+    Tick::alive = 0;
+    {
+        EDF::RadixHeap<Tick, 8, TickOf> heap;
+        EXPECT_EQ( Tick::alive, 0 );
+        heap.emplace( 7u );
+        heap.push( Tick( 3 ) );
+        heap.emplace( 5u );
+        EXPECT_EQ( Tick::alive, 3 );
+        EXPECT_EQ( heap.pop().get(), 3u );
+        EXPECT_EQ( Tick::alive, 2 );
+        heap.clear();
+        EXPECT_EQ( Tick::alive, 0 );
+        heap.emplace( 9u );
+        heap.emplace( 4u );
+    }
+    EXPECT_EQ( Tick::alive, 0 );
+}
+
+TEST(RadixHeap, MatchesHeapMin) {
+    EDF::RadixHeap<std::uint32_t, 128> radix;
+    EDF::HeapMin<std::uint32_t, 128> heap;
+    std::uint32_t now = 0;
+    std::uint32_t state = 2024;
+    for( int round = 0; round < 5000; ++round ) {
+        state = state * 1103515245u + 12345u;
+        if( !radix.isFull() && ((state >> 16) % 3 != 0 || radix.isEmpty()) ) {
+            const std::uint32_t key = now + ((state >> 8) % 5000);
+            radix.push( key );
+            heap.push( key );
+        }
+        else {
+            EXPECT_EQ( radix.peek(), heap.peek() );
+            now = radix.pop();
+            ASSERT_EQ( now, heap.pop() );
+        }
+        ASSERT_EQ( radix.length(), heap.length() );
+    }
+}
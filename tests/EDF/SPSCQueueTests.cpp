@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/SPSCQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+TEST(SPSCQueue, Initialization) {
+    EDF::SPSCQueue<int, 32> queue;
+    EXPECT_EQ( queue.maxLength(), 31 );
+    EXPECT_EQ( queue.length(), 0 );
+    EXPECT_TRUE( queue.isEmpty() );
+
+    EDF::SPSCQueue<int, 8> queueIList = { 3, 2, 1 };
+    EXPECT_EQ( queueIList.maxLength(), 7 );
+    EXPECT_EQ( queueIList.length(), 3 );
+    EXPECT_EQ( queueIList.peek(), 3 );
+}
+
+TEST(SPSCQueue, IsFull) {
+    EDF::SPSCQueue<int, 4> queue;
+    EXPECT_FALSE( queue.isFull() );
+
+    queue.push( 10 );
+    queue.push( 11 );
+    queue.push( 12 );
+    EXPECT_TRUE( queue.isFull() );
+    EXPECT_DEATH( queue.push( 13 ), "" );
+}
+
+TEST(SPSCQueue, PushPopWrap) {
+    EDF::SPSCQueue<int, 4> queuePow2;
+    EDF::SPSCQueue<int, 5> queueNotPow2;
+    for( int k = 0; k < 20; ++k ) {
+        queuePow2.push( k );
+        queuePow2.push( k + 100 );
+        queueNotPow2.push( k );
+        queueNotPow2.push( k + 100 );
+        EXPECT_EQ( queuePow2.length(), 2 );
+        EXPECT_EQ( queueNotPow2.length(), 2 );
+        EXPECT_EQ( queuePow2.pop(), k );
+        EXPECT_EQ( queuePow2.pop(), k + 100 );
+        EXPECT_EQ( queueNotPow2.pop(), k );
+        EXPECT_EQ( queueNotPow2.pop(), k + 100 );
+    }
+    EXPECT_TRUE( queuePow2.isEmpty() );
+    EXPECT_TRUE( queueNotPow2.isEmpty() );
+    EXPECT_DEATH( queuePow2.pop(), "" );
+}
+
+TEST(SPSCQueue, EmplaceClear) {
+    struct Pair { int a; int b; Pair( int x = 0, int y = 0 ) : a(x), b(y) {} };
+    EDF::SPSCQueue<Pair, 8> queue;
+    queue.emplace( 1, 2 );
+    EXPECT_EQ( queue.peek().a, 1 );
+    EXPECT_EQ( queue.peek().b, 2 );
+
+    queue.emplace( 3, 4 );
+    queue.clear();
+    EXPECT_TRUE( queue.isEmpty() );
+}
+
+TEST(SPSCQueue, ProducerConsumerThreads) {
+    constexpr std::uint32_t COUNT = 200000;
+    static EDF::SPSCQueue<std::uint32_t, 64> queue;
+
+    std::thread producer( [](){
+        for( std::uint32_t k = 0; k < COUNT; ++k ) {
+            while( queue.isFull() ) {
+                std::this_thread::yield();
+            }
+            queue.push( k );
+        }
+    });
+
+    std::uint32_t expected = 0;
+    std::uint32_t outOfOrder = 0;
+    while( expected < COUNT ) {
+        if( queue.isEmpty() ) {
+            std::this_thread::yield();
+            continue;
+        }
+        if( queue.pop() != expected ) {
+            ++outOfOrder;
+        }
+        ++expected;
+    }
+    producer.join();
+
+    EXPECT_EQ( outOfOrder, 0 );
+    EXPECT_TRUE( queue.isEmpty() );
+}
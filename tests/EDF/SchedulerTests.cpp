@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Scheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+struct FakeClock {
+    static inline std::uint32_t ticks = 0;
+    static std::uint32_t now() { return ticks; }
+};
+
+struct FakeClock16 {
+    static inline std::uint16_t ticks = 0;
+    static std::uint16_t now() { return ticks; }
+};
+
+void increment( void* context ) {
+    ++*static_cast<int*>(context);
+}
+
+// Records the order callbacks ran in
+struct Log {
+    int order[16] = {};
+    int n = 0;
+};
+template<int ID>
+void record( void* context ) {
+    auto* log = static_cast<Log*>(context);
+    log->order[log->n++] = ID;
+}
+} /* anonymous */
+
+TEST(Scheduler, Initialization) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<8, FakeClock> scheduler;
+    EXPECT_EQ( scheduler.maxLength(), 8 );
+    EXPECT_EQ( scheduler.length(), 0 );
+    EXPECT_TRUE( scheduler.isEmpty() );
+    EXPECT_FALSE( scheduler.hasPending() );
+    EXPECT_EQ( scheduler.runUntilIdle( 100 ), 0 );
+}
+
+TEST(Scheduler, OneShot) {
+    FakeClock::ticks = 1000;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    int count = 0;
+    auto id = scheduler.schedule( increment, &count, 10 );
+    EXPECT_TRUE( id.isValid() );
+    EXPECT_TRUE( scheduler.isScheduled( id ) );
+    EXPECT_EQ( scheduler.ticksUntilNext( 1000 ), 10 );
+
+    EXPECT_EQ( scheduler.runUntilIdle( 1009 ), 0 );
+    EXPECT_EQ( count, 0 );
+    EXPECT_EQ( scheduler.runUntilIdle( 1010 ), 1 );
+    EXPECT_EQ( count, 1 );
+    EXPECT_FALSE( scheduler.isScheduled( id ) );
+    EXPECT_TRUE( scheduler.isEmpty() );
+    EXPECT_EQ( scheduler.runUntilIdle( 2000 ), 0 );
+    EXPECT_EQ( count, 1 );
+    EXPECT_EQ( scheduler.lateDispatches(), 0 );
+}
+
+TEST(Scheduler, Periodic) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    int count = 0;
+    scheduler.schedule( increment, &count, 5, 10 );
+    for( std::uint32_t now = 0; now <= 100; ++now ) {
+        FakeClock::ticks = now;
+        scheduler.runUntilIdle( now );
+    }
+    // Due at 5, 15, ..., 95
+    EXPECT_EQ( count, 10 );
+    EXPECT_EQ( scheduler.lateDispatches(), 0 );
+    EXPECT_EQ( scheduler.ticksUntilNext( 100 ), 5 );
+}
+
+TEST(Scheduler, DeadlineOrder) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    Log log;
+    scheduler.schedule( record<3>, &log, 30 );
+    scheduler.schedule( record<1>, &log, 10 );
+    scheduler.schedule( record<2>, &log, 20 );
+    scheduler.schedule( record<0>, &log, 0 );
+    EXPECT_TRUE( scheduler.isFull() );
+    EXPECT_FALSE( scheduler.schedule( record<4>, &log, 0 ).isValid() );
+
+    EXPECT_EQ( scheduler.runUntilIdle( 50 ), 4 );
+    ASSERT_EQ( log.n, 4 );
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_EQ( log.order[k], k );
+    }
+}
+
+TEST(Scheduler, Cancel) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    int a = 0;
+    int b = 0;
+    auto idA = scheduler.schedule( increment, &a, 10, 10 );
+    auto idB = scheduler.schedule( increment, &b, 10 );
+    EXPECT_TRUE( scheduler.cancel( idA ) );
+    EXPECT_FALSE( scheduler.cancel( idA ) );
+    EXPECT_EQ( scheduler.length(), 1 );
+
+    // The freed slot is reused, the old id must not cancel the new job
+    int c = 0;
+    auto idC = scheduler.schedule( increment, &c, 10 );
+    EXPECT_EQ( idC.slot, idA.slot );
+    EXPECT_NE( idC, idA );
+    EXPECT_FALSE( scheduler.cancel( idA ) );
+
+    scheduler.runUntilIdle( 100 );
+    EXPECT_EQ( a, 0 );
+    EXPECT_EQ( b, 1 );
+    EXPECT_EQ( c, 1 );
+    EXPECT_FALSE( scheduler.cancel( idB ) );
+}
+
+TEST(Scheduler, ReusesEverySlot) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    int count = 0;
+    EDF::Scheduler<4, FakeClock>::JobId ids[4];
+    for( auto& id : ids ) {
+        id = scheduler.schedule( increment, &count, 10 );
+    }
+    EXPECT_TRUE( scheduler.cancel( ids[2] ) );
+    EXPECT_TRUE( scheduler.cancel( ids[0] ) );
+    EXPECT_EQ( scheduler.schedule( increment, &count, 10 ).slot, ids[0].slot );
+    EXPECT_EQ( scheduler.schedule( increment, &count, 10 ).slot, ids[2].slot );
+    EXPECT_FALSE( scheduler.schedule( increment, &count, 10 ).isValid() );
+
+    EXPECT_EQ( scheduler.runUntilIdle( 10 ), 4 );
+    EXPECT_TRUE( scheduler.isEmpty() );
+    for( int k = 0; k < 4; ++k ) {
+        EXPECT_TRUE( scheduler.schedule( increment, &count, 10 ).isValid() );
+    }
+    EXPECT_TRUE( scheduler.isFull() );
+    EXPECT_FALSE( scheduler.schedule( increment, &count, 10 ).isValid() );
+}
+
+namespace {
+struct CancelOther {
+    EDF::Scheduler<4, FakeClock>* scheduler;
+    EDF::Scheduler<4, FakeClock>::JobId other;
+    int runs = 0;
+};
+void cancelOther( void* context ) {
+    auto* self = static_cast<CancelOther*>(context);
+    ++self->runs;
+    self->scheduler->cancel( self->other );
+}
+
+struct Rescheduler {
+    EDF::Scheduler<4, FakeClock>* scheduler;
+    int runs = 0;
+};
+void rescheduleNow( void* context ) {
+    auto* self = static_cast<Rescheduler*>(context);
+    if( ++self->runs < 3 ) {
+        self->scheduler->schedule( rescheduleNow, self, 0 );
+    }
+}
+} /* anonymous */
+
+TEST(Scheduler, CallbacksModifySchedule) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+
+    // Both due at the same time, the first one cancels the second while it's in the ready queue
+    int count = 0;
+    CancelOther canceller{ &scheduler, {}, 0 };
+    scheduler.schedule( cancelOther, &canceller, 5 );
+    canceller.other = scheduler.schedule( increment, &count, 6 );
+    EXPECT_EQ( scheduler.runUntilIdle( 10 ), 1 );
+    EXPECT_EQ( canceller.runs, 1 );
+    EXPECT_EQ( count, 0 );
+    EXPECT_TRUE( scheduler.isEmpty() );
+
+    // Jobs that become due while dispatching run in the same call
+    FakeClock::ticks = 10;
+    Rescheduler rescheduler{ &scheduler, 0 };
+    scheduler.schedule( rescheduleNow, &rescheduler, 0 );
+    EXPECT_EQ( scheduler.runUntilIdle( 10 ), 3 );
+    EXPECT_EQ( rescheduler.runs, 3 );
+}
+
+namespace {
+struct Counter {
+    EDF::Scheduler<4, FakeClock>* scheduler;
+    int runs = 0;
+};
+void rescheduleLater( void* context ) {
+    auto* self = static_cast<Counter*>(context);
+    ++self->runs;
+    self->scheduler->schedule( rescheduleLater, self, 5 );
+}
+void cancelAndCount( void* context ) {
+    auto* self = static_cast<CancelOther*>(context);
+    self->scheduler->cancel( self->other );
+    self->runs = static_cast<int>(self->scheduler->length());
+}
+} /* anonymous */
+
+TEST(Scheduler, RescheduleFromCallbackUsesDispatchTime) {
+    // now is ahead of the clock, a delay of 5 from Clock::now() would still be due at now
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    Counter counter{ &scheduler };
+    scheduler.schedule( rescheduleLater, &counter, 0 );
+    EXPECT_EQ( scheduler.runUntilIdle( 100 ), 1 );
+    EXPECT_EQ( counter.runs, 1 );
+    EXPECT_EQ( scheduler.ticksUntilNext( 100 ), 5 );
+    EXPECT_EQ( scheduler.runUntilIdle( 104 ), 0 );
+    EXPECT_EQ( scheduler.runUntilIdle( 105 ), 1 );
+    EXPECT_EQ( counter.runs, 2 );
+}
+
+TEST(Scheduler, LengthInsideCallbacks) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler;
+    int count = 0;
+    // Both due together, the first cancels the second while it's still in the ready queue
+    CancelOther canceller{ &scheduler, {}, 0 };
+    scheduler.schedule( cancelAndCount, &canceller, 1 );
+    canceller.other = scheduler.schedule( increment, &count, 2 );
+    scheduler.schedule( increment, &count, 50 );
+    EXPECT_EQ( scheduler.length(), 3 );
+    EXPECT_EQ( scheduler.runUntilIdle( 10 ), 1 );
+    // The canceller itself was released before it ran, only the job at 50 is left
+    EXPECT_EQ( canceller.runs, 1 );
+    EXPECT_EQ( scheduler.length(), 1 );
+    EXPECT_FALSE( scheduler.isEmpty() );
+}
+
+TEST(Scheduler, LateDispatches) {
+    FakeClock::ticks = 0;
+    EDF::Scheduler<4, FakeClock> scheduler( 2 );
+    int count = 0;
+    scheduler.schedule( increment, &count, 10, 10 );
+
+    scheduler.runUntilIdle( 12 );   // 2 late, within tolerance
+    EXPECT_EQ( scheduler.lateDispatches(), 0 );
+    EXPECT_EQ( scheduler.maxLateness(), 2 );
+
+    scheduler.runUntilIdle( 25 );   // 5 late
+    EXPECT_EQ( scheduler.lateDispatches(), 1 );
+    EXPECT_EQ( scheduler.maxLateness(), 5 );
+
+    // Far behind, the missed runs at 30..60 are skipped, and the next deadline stays on the period
+    scheduler.runUntilIdle( 65 );
+    EXPECT_EQ( count, 3 );
+    EXPECT_EQ( scheduler.lateDispatches(), 2 );
+    EXPECT_EQ( scheduler.maxLateness(), 35 );
+    EXPECT_EQ( scheduler.ticksUntilNext( 65 ), 5 );
+
+    scheduler.resetStatistics();
+    EXPECT_EQ( scheduler.lateDispatches(), 0 );
+    EXPECT_EQ( scheduler.maxLateness(), 0 );
+}
+
+TEST(Scheduler, TickWrap) {
+    FakeClock16::ticks = 65530;
+    EDF::Scheduler<4, FakeClock16> scheduler;
+    Log log;
+    scheduler.schedule( record<1>, &log, 10 );     // due at 4, after the wrap
+    scheduler.schedule( record<0>, &log, 3 );      // due at 65533
+    EXPECT_EQ( scheduler.ticksUntilNext( 65530 ), 3 );
+
+    EXPECT_EQ( scheduler.runUntilIdle( 65533 ), 1 );
+    EXPECT_EQ( scheduler.runUntilIdle( 2 ), 0 );
+    EXPECT_EQ( scheduler.runUntilIdle( 4 ), 1 );
+    ASSERT_EQ( log.n, 2 );
+    EXPECT_EQ( log.order[0], 0 );
+    EXPECT_EQ( log.order[1], 1 );
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/SmallVector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace {
+// Counts live objects, to check elements survive being moved to an allocated buffer exactly once
+class Counted {
+private:
+    int variable;
+public:
+    static inline int alive = 0;
+    explicit Counted( int initialValue ) : variable(initialValue) { ++alive; }
+    Counted( const Counted& other ) : variable(other.variable) { ++alive; }
+    Counted( Counted&& other ) : variable(other.variable) { ++alive; }
+    Counted& operator=( const Counted& other ) = default;
+    Counted& operator=( Counted&& other ) = default;
+    ~Counted() { --alive; }
+    int getValue() const { return variable; }
+};
+} /* anonymous */
+
+// Forwards to std::allocator, and counts how often it is used
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline int allocations = 0;
+    static inline int deallocations = 0;
+
+    CountingAllocator() = default;
+    template<typename U>
+    CountingAllocator( const CountingAllocator<U>& ) {}
+
+    T* allocate( std::size_t count )                        { ++allocations; return std::allocator<T>().allocate( count ); }
+    void deallocate( T* pointer, std::size_t count )        { ++deallocations; std::allocator<T>().deallocate( pointer, count ); }
+
+    friend bool operator==( const CountingAllocator&, const CountingAllocator& ) { return true; }
+    friend bool operator!=( const CountingAllocator&, const CountingAllocator& ) { return false; }
+};
+
+// Generic code written against Vector compiles unchanged against SmallVector
+template<typename V>
+int sumOfSquares( const V& values ) {
+    int sum = 0;
+    for( const auto& value : values ) {
+        sum += value * value;
+    }
+    return sum;
+}
+
+TEST(SmallVector, Initialization) {
+    EDF::SmallVector<int, 4> vector;
+    EXPECT_TRUE( vector.isEmpty() );
+    EXPECT_TRUE( vector.isInline() );
+    EXPECT_EQ( vector.capacity(), 4 );
+
+    EDF::SmallVector<int, 4> vectorIList = { 1, 2, 3 };
+    EXPECT_EQ( vectorIList.length(), 3 );
+    EXPECT_TRUE( vectorIList.isInline() );
+    EXPECT_EQ( vectorIList[2], 3 );
+
+    EDF::SmallVector<int, 2> spilled = { 1, 2, 3 };
+    EXPECT_EQ( spilled.length(), 3 );
+    EXPECT_FALSE( spilled.isInline() );
+    EXPECT_EQ( spilled.back(), 3 );
+}
+
+TEST(SmallVector, SameIteratorTypesAsVector) {
+    static_assert( std::is_same_v<EDF::SmallVector<int, 4>::Iterator, EDF::Vector<int, 4>::Iterator> );
+    static_assert( std::is_same_v<EDF::SmallVector<int, 4>::ConstIterator, EDF::Vector<int, 4>::ConstIterator> );
+
+    EDF::Vector<int, 4> vector = { 1, 2, 3 };
+    EDF::SmallVector<int, 4> smallVector = { 1, 2, 3 };
+    EXPECT_EQ( sumOfSquares( vector ), sumOfSquares( smallVector ) );
+}
+
+TEST(SmallVector, NoAllocationWhileInline) {
+    using Allocator = CountingAllocator<int>;
+    Allocator::allocations = 0;
+    Allocator::deallocations = 0;
+    {
+        EDF::SmallVector<int, 8, Allocator> vector;
+        for( int k = 0; k < 8; ++k ) {
+            vector.pushBack( k );
+        }
+        EXPECT_TRUE( vector.isInline() );
+        EXPECT_EQ( Allocator::allocations, 0 );
+    }
+    EXPECT_EQ( Allocator::deallocations, 0 );
+}
+
+TEST(SmallVector, GeometricGrowth) {
+    using Allocator = CountingAllocator<int>;
+    Allocator::allocations = 0;
+    Allocator::deallocations = 0;
+    {
+        EDF::SmallVector<int, 4, Allocator> vector;
+        for( int k = 0; k < 100; ++k ) {
+            vector.pushBack( k );
+        }
+        EXPECT_FALSE( vector.isInline() );
+        EXPECT_EQ( vector.length(), 100 );
+        EXPECT_EQ( vector.capacity(), 128 );
+        // 4 -> 8 -> 16 -> 32 -> 64 -> 128
+        EXPECT_EQ( Allocator::allocations, 5 );
+        for( std::size_t k = 0; k < vector.length(); ++k ) {
+            EXPECT_EQ( vector[k], static_cast<int>(k) );
+        }
+    }
+    EXPECT_EQ( Allocator::deallocations, Allocator::allocations );
+}
+
+TEST(SmallVector, Reserve) {
+    EDF::SmallVector<int, 4> vector = { 1, 2 };
+    vector.reserve( 3 );
+    EXPECT_TRUE( vector.isInline() );
+
+    vector.reserve( 10 );
+    EXPECT_FALSE( vector.isInline() );
+    EXPECT_EQ( vector.capacity(), 10 );
+    EXPECT_EQ( vector.length(), 2 );
+    EXPECT_EQ( vector[1], 2 );
+}
+
+TEST(SmallVector, InsertErase) {
+    EDF::SmallVector<int, 4> vector = { 1, 4 };
+
+    vector.insert( 1, 3 );
+    vector.insert( vector.begin() + 1, 2 );
+    vector.insert( vector.end(), { 5, 6 } );
+    vector.insert( 0_uz, 2, 0 );
+    const int expected[] = { 0, 0, 1, 2, 3, 4, 5, 6 };
+    ASSERT_EQ( vector.length(), 8 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k], expected[k] );
+    }
+
+    vector.erase( 0_uz, 2_uz );
+    vector.erase( vector.begin() + 1 );
+    const int remaining[] = { 1, 3, 4, 5, 6 };
+    ASSERT_EQ( vector.length(), 5 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k], remaining[k] );
+    }
+    EXPECT_EQ( vector.popBack(), 6 );
+}
+
+TEST(SmallVector, InsertOwnElementWhileGrowing) {
+    EDF::SmallVector<int, 2> vector = { 7, 8 };
+
+    // Both need the buffer to grow, and refer to an element in the buffer being replaced
+    vector.pushBack( vector[0] );
+    vector.insert( vector.begin(), 2, vector[1] );
+    const int expected[] = { 8, 8, 7, 8, 7 };
+    ASSERT_EQ( vector.length(), 5 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k], expected[k] );
+    }
+}
+
+TEST(SmallVector, NotTriviallyCopyable) {
+    Counted::alive = 0;
+    {
+        EDF::SmallVector<Counted, 2> vector;
+        for( int k = 0; k < 10; ++k ) {
+            vector.emplaceBack( k );
+        }
+        EXPECT_EQ( Counted::alive, 10 );
+
+        vector.emplace( 0_uz, -1 );
+        vector.erase( vector.begin() + 1, vector.begin() + 4 );
+        EXPECT_EQ( Counted::alive, 8 );
+        EXPECT_EQ( vector.front().getValue(), -1 );
+        EXPECT_EQ( vector[1].getValue(), 3 );
+
+        vector.resize( 3, Counted( 0 ) );
+        EXPECT_EQ( Counted::alive, 3 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(SmallVector, CopyAndMove) {
+    Counted::alive = 0;
+    {
+        EDF::SmallVector<Counted, 4> inlineVector;
+        inlineVector.emplaceBack( 1 );
+        EDF::SmallVector<Counted, 4> spilledVector;
+        for( int k = 0; k < 6; ++k ) {
+            spilledVector.emplaceBack( k );
+        }
+
+        EDF::SmallVector<Counted, 4> copy( spilledVector );
+        EXPECT_EQ( copy.length(), 6 );
+        EXPECT_EQ( copy[5].getValue(), 5 );
+        EXPECT_EQ( Counted::alive, 13 );
+
+        // The allocated buffer changes owner, no elements are moved
+        const Counted* buffer = spilledVector.data();
+        EDF::SmallVector<Counted, 4> moved( std::move(spilledVector) );
+        EXPECT_EQ( moved.data(), buffer );
+        EXPECT_TRUE( spilledVector.isEmpty() );
+        EXPECT_TRUE( spilledVector.isInline() );
+
+        EDF::SmallVector<Counted, 4> movedInline( std::move(inlineVector) );
+        EXPECT_TRUE( movedInline.isInline() );
+        EXPECT_EQ( movedInline.front().getValue(), 1 );
+
+        copy = movedInline;
+        EXPECT_EQ( copy.length(), 1 );
+        moved = std::move(copy);
+        EXPECT_EQ( moved.length(), 1 );
+        EXPECT_EQ( Counted::alive, 2 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(SmallVector, AppendResizeCommit) {
+    EDF::SmallVector<int, 4> vector;
+    const int values[] = { 1, 2, 3, 4, 5, 6 };
+
+    vector.append( std::begin( values ), std::end( values ) );
+    ASSERT_EQ( vector.length(), 6 );
+    EXPECT_EQ( vector[5], 6 );
+
+    vector.assign( std::begin( values ), std::begin( values ) + 2 );
+    ASSERT_EQ( vector.length(), 2 );
+
+    vector.resize( 4 );
+    EXPECT_EQ( vector[3], 0 );
+
+    vector.reserve( 16 );
+    auto spare = vector.spareCapacity();
+    ASSERT_EQ( spare.length(), 12 );
+    spare[0] = 42;
+    vector.commit( 1 );
+    EXPECT_EQ( vector.length(), 5 );
+    EXPECT_EQ( vector.back(), 42 );
+}
+
+TEST(SmallVector, Equality) {
+    EDF::SmallVector<int, 2> lhs = { 1, 2, 3 };
+    EDF::SmallVector<int, 2> rhs = { 1, 2 };
+    EXPECT_FALSE( lhs == rhs );
+    rhs.pushBack( 3 );
+    EXPECT_TRUE( lhs == rhs );
+}
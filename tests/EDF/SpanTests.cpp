@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Adam Veazey
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <EDF/Span.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Span, Initialization) {
+    EDF::Span<int> spanDefault;
+    EXPECT_TRUE( spanDefault.isEmpty() );
+    EXPECT_EQ( spanDefault.data(), nullptr );
+
+    int array[] = { 1, 2, 3, 4 };
+    EDF::Span<int> spanArray( array );
+    EXPECT_EQ( spanArray.length(), 4 );
+    EXPECT_EQ( spanArray.lengthBytes(), 4 * sizeof(int) );
+
+    EDF::Span<const int> spanPointer( array + 1, 2 );
+    EXPECT_EQ( spanPointer.length(), 2 );
+    EXPECT_EQ( spanPointer.front(), 2 );
+    EXPECT_EQ( spanPointer.back(), 3 );
+}
+
+TEST(Span, ElementAccess) {
+    int array[] = { 1, 2, 3, 4 };
+    EDF::Span<int> span( array );
+    span[0] = 10;
+    span.at( 3 ) = 40;
+    EXPECT_EQ( array[0], 10 );
+    EXPECT_EQ( array[3], 40 );
+    EXPECT_DEATH( span.at( 4 ), "" );
+}
+
+TEST(Span, SubSpans) {
+    int array[] = { 1, 2, 3, 4, 5 };
+    EDF::Span<int> span( array );
+    EXPECT_EQ( span.first( 2 ).back(), 2 );
+    EXPECT_EQ( span.last( 2 ).front(), 4 );
+    EXPECT_EQ( span.subspan( 1, 3 ).length(), 3 );
+    EXPECT_EQ( span.subspan( 1, 3 ).front(), 2 );
+    EXPECT_DEATH( span.subspan( 3, 3 ), "" );
+}
+
+TEST(Span, Iterators) {
+    int array[] = { 1, 2, 3, 4, 5 };
+    EDF::Span<int> span( array );
+    int sum = 0;
+    for( auto&& v : span ) {
+        sum += v;
+    }
+    EXPECT_EQ( sum, 15 );
+    EXPECT_EQ( *span.rbegin(), 5 );
+}
@@ -8,6 +8,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 class CustomClass {
 private:
     int variable;
@@ -29,6 +36,12 @@ TEST(Stack, InitializationInt) {
     EXPECT_EQ( stackIntIList.peek(), 1 );
 }
 
+namespace {
+constexpr EDF::Stack<int, 8> constantStack = { 3, 2, 1 };
+static_assert( constantStack.length() == 3 );
+static_assert( constantStack.peek() == 1 );
+} /* anonymous */
+
 TEST(Stack, InitializationCustomClass) {
     EDF::Stack<CustomClass, 32> stackCustomClass;
     EXPECT_EQ( stackCustomClass.maxLength(), 32 );
@@ -166,4 +179,120 @@ TEST(Stack, Clear) {
 
     stack.clear();
     EXPECT_EQ( stack.length(), 0 );
-}
\ No newline at end of file
+}
+
+TEST(Stack, NotDefaultConstructible) {
+    struct Handle {
+        int id;
+        explicit Handle( int i ) : id(i) {}
+    };
+    static_assert( !std::is_default_constructible_v<Handle> );
+
+    EDF::Stack<Handle, 4> stack;
+    stack.push( Handle( 1 ) );
+    stack.emplace( 2 );
+    EXPECT_EQ( stack.length(), 2 );
+    EXPECT_EQ( stack.pop().id, 2 );
+    EXPECT_EQ( stack.peek().id, 1 );
+}
+
+TEST(Stack, PushMovesRValues) {
+    EDF::Stack<std::unique_ptr<int>, 4> stack;
+    auto value = std::make_unique<int>( 7 );
+    stack.push( std::move(value) );
+    EXPECT_EQ( value, nullptr );
+    EXPECT_EQ( *stack.peek(), 7 );
+}
+
+TEST(Stack, PushNPopN) {
+    EDF::Stack<int, 8> stack = { 1 };
+    const int values[] = { 2, 3, 4, 5 };
+    stack.pushN( values, 4 );
+    EXPECT_EQ( stack.length(), 5 );
+    EXPECT_EQ( stack.peek(), 5 );
+
+    int popped[3] = {};
+    stack.popN( popped, 3 );
+    EXPECT_EQ( popped[0], 5 );
+    EXPECT_EQ( popped[1], 4 );
+    EXPECT_EQ( popped[2], 3 );
+    EXPECT_EQ( stack.length(), 2 );
+    EXPECT_EQ( stack.peek(), 2 );
+
+    stack.popN( 2 );
+    EXPECT_TRUE( stack.isEmpty() );
+    EXPECT_DEATH( stack.popN( 1 ), "" );
+    EXPECT_DEATH( stack.pushN( values, 9 ), "" );
+}
+
+TEST(AtomicStack, PushPop) {
+    EDF::AtomicStack<int, 3> stack;
+    EXPECT_TRUE( stack.isEmpty() );
+    EXPECT_EQ( stack.maxLength(), 3 );
+    EXPECT_TRUE( stack.push( 1 ) );
+    EXPECT_TRUE( stack.push( 2 ) );
+    EXPECT_TRUE( stack.emplace( 3 ) );
+    EXPECT_TRUE( stack.isFull() );
+    EXPECT_FALSE( stack.push( 4 ) );
+
+    int value = 0;
+    EXPECT_TRUE( stack.pop( value ) );
+    EXPECT_EQ( value, 3 );
+    EXPECT_TRUE( stack.push( 5 ) );
+    EXPECT_TRUE( stack.pop( value ) );
+    EXPECT_EQ( value, 5 );
+    EXPECT_TRUE( stack.pop( value ) );
+    EXPECT_EQ( value, 2 );
+    EXPECT_TRUE( stack.pop( value ) );
+    EXPECT_EQ( value, 1 );
+    EXPECT_FALSE( stack.pop( value ) );
+    EXPECT_EQ( value, 1 );
+    EXPECT_TRUE( stack.isEmpty() );
+}
+
+TEST(AtomicStack, DestroysElements) {
+    auto shared = std::make_shared<int>( 0 );
+    {
+        EDF::AtomicStack<std::shared_ptr<int>, 4> stack;
+        stack.push( shared );
+        stack.push( shared );
+        stack.push( shared );
+        std::shared_ptr<int> value;
+        stack.pop( value );
+        EXPECT_EQ( shared.use_count(), 4 );
+    }
+    EXPECT_EQ( shared.use_count(), 1 );
+}
+
+TEST(AtomicStack, ThreadsPushAndPopEveryValueOnce) {
+    constexpr int THREADS = 4;
+    constexpr std::uint32_t ITERATIONS = 20000;
+    EDF::AtomicStack<std::uint32_t, 8> stack;
+    std::atomic<std::uint64_t> pushed{ 0 };
+    std::atomic<std::uint64_t> popped{ 0 };
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREADS; ++t ) {
+        threads.emplace_back( [&stack, &pushed, &popped, t](){
+            for( std::uint32_t k = 0; k < ITERATIONS; ++k ) {
+                const std::uint32_t value = (static_cast<std::uint32_t>(t) << 24) | k;
+                if( stack.push( value ) ) {
+                    pushed += value;
+                }
+                std::uint32_t out;
+                if( stack.pop( out ) ) {
+                    popped += out;
+                }
+            }
+        } );
+    }
+    for( auto& thread : threads ) {
+        thread.join();
+    }
+    std::uint32_t out;
+    while( stack.pop( out ) ) {
+        popped += out;
+    }
+    EXPECT_EQ( pushed, popped );
+    EXPECT_TRUE( stack.isEmpty() );
+}
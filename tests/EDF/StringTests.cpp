@@ -24,6 +24,10 @@ TEST(String, InitializationFromPointer) {
     EDF::String<32> stringUint8_t( reinterpret_cast<const uint8_t*>("const uint8_t*") );
     EXPECT_EQ( stringUint8_t.length(), std::strlen("const uint8_t*") );
     EXPECT_STREQ( stringUint8_t.asCString(), "const uint8_t*" );
+
+    EDF::String<32> stringEmpty( "" );
+    EXPECT_TRUE( stringEmpty.isEmpty() );
+    EXPECT_STREQ( stringEmpty.asCString(), "" );
 }
 
 TEST(String, InitializationFromPointerAndLength) {
@@ -875,6 +879,14 @@ TEST(String, Equals) {
     EXPECT_TRUE( EDF::String<16>("Hello, world!").equals( EDF::String<14>("Hello, world!") ) );
 }
 
+TEST(String, EqualityOperators) {
+    EXPECT_TRUE( EDF::String<16>("Hello") == EDF::String<16>("Hello") );
+    EXPECT_TRUE( EDF::String<16>("Hello") == EDF::String<8>("Hello") );
+    EXPECT_FALSE( EDF::String<16>("Hello") == EDF::String<8>("Help") );
+    EXPECT_TRUE( EDF::String<16>("Hello") != EDF::String<8>("hello") );
+    EXPECT_FALSE( EDF::String<8>("Hello") != EDF::String<16>("Hello") );
+}
+
 TEST(String, Strip) {
     EXPECT_STREQ( EDF::String<32>(" \x1B Hello, world! \r\n ").strip().asCString(), "Hello,world!" );
     EXPECT_STREQ( EDF::String<32>(" \x1B Hello, world! \r\n ").strip( 'l' ).asCString(), " \x1B Heo, word! \r\n " );
@@ -8,6 +8,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+
 class CustomClass {
 private:
     int variable;
@@ -48,6 +54,15 @@ TEST(Vector, InitializationCustomClass) {
     EXPECT_EQ( vectorIntIList[2].getValue(), 1 );
 }
 
+namespace {
+// The list constructor still works in constant expressions, for literal types
+constexpr EDF::Vector<int, 8> constantInts = { 3, 2, 1 };
+static_assert( constantInts.length() == 3 );
+static_assert( constantInts[0] == 3 && constantInts[2] == 1 );
+constexpr EDF::Vector<CustomClass, 2> constantCustom = { CustomClass( 4 ), CustomClass( 5 ) };
+static_assert( constantCustom.back().getValue() == 5 );
+} /* anonymous */
+
 TEST(Vector, IsEmpty) {
     EDF::Vector<int, 4> vector;
     EXPECT_TRUE( vector.isEmpty() );
@@ -330,6 +345,133 @@ TEST(Vector, EraseByIterator) {
     EXPECT_EQ( vector[0], 1 );
 }
 
+// Not trivially copyable, so shifting elements takes the element by element path
+class Tracked {
+private:
+    int variable;
+public:
+    Tracked( int initialValue = 0 ) : variable(initialValue) {}
+    Tracked( const Tracked& other ) : variable(other.variable) {}
+    Tracked& operator=( const Tracked& other ) { variable = other.variable; return *this; }
+    ~Tracked() {}
+    int getValue() const { return variable; }
+};
+static_assert( !std::is_trivially_copyable_v<Tracked> );
+
+TEST(Vector, ShiftNotTriviallyCopyable) {
+    EDF::Vector<Tracked, 8> vector = { 1, 2, 3, 4, 5 };
+
+    vector.erase( vector.begin() );
+    ASSERT_EQ( vector.length(), 4 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k].getValue(), static_cast<int>(k + 2) );
+    }
+
+    vector.erase( vector.begin(), vector.begin() + 2 );
+    ASSERT_EQ( vector.length(), 2 );
+    EXPECT_EQ( vector[0].getValue(), 4 );
+    EXPECT_EQ( vector[1].getValue(), 5 );
+
+    vector.insert( vector.begin(), { Tracked( 1 ), Tracked( 2 ), Tracked( 3 ) } );
+    vector.insert( vector.begin() + 1, 2, Tracked( 9 ) );
+    const int expected[] = { 1, 9, 9, 2, 3, 4, 5 };
+    ASSERT_EQ( vector.length(), 7 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k].getValue(), expected[k] );
+    }
+}
+
+TEST(Vector, ShiftTriviallyCopyable) {
+    struct Pair { std::uint16_t a; std::uint8_t b; };
+    static_assert( std::is_trivially_copyable_v<Pair> );
+    EDF::Vector<Pair, 8> vector;
+    for( std::uint8_t k = 0; k < 5; ++k ) {
+        vector.pushBack( Pair{ static_cast<std::uint16_t>(k * 100), k } );
+    }
+
+    vector.emplace( vector.begin(), Pair{ 7, 7 } );
+    vector.erase( vector.begin() + 2 );
+    const std::uint8_t expected[] = { 7, 0, 2, 3, 4 };
+    ASSERT_EQ( vector.length(), 5 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k].b, expected[k] );
+    }
+
+    vector.erase( vector.begin() + 1, vector.begin() + 4 );
+    ASSERT_EQ( vector.length(), 2 );
+    EXPECT_EQ( vector[0].a, 7 );
+    EXPECT_EQ( vector[1].a, 400 );
+}
+
+namespace {
+// Counts live objects, to check only the elements in the vector are ever constructed or destroyed
+class Counted {
+private:
+    int variable;
+public:
+    static inline int alive = 0;
+    explicit Counted( int initialValue ) : variable(initialValue) { ++alive; }
+    Counted( const Counted& other ) : variable(other.variable) { ++alive; }
+    Counted( Counted&& other ) : variable(other.variable) { ++alive; }
+    Counted& operator=( const Counted& other ) = default;
+    Counted& operator=( Counted&& other ) = default;
+    ~Counted() { --alive; }
+    int getValue() const { return variable; }
+};
+static_assert( !std::is_default_constructible_v<Counted> );
+} /* anonymous */
+
+TEST(Vector, NotDefaultConstructible) {
+    Counted::alive = 0;
+    {
+        EDF::Vector<Counted, 64> vector;
+        EXPECT_EQ( Counted::alive, 0 );
+
+        vector.emplaceBack( 1 );
+        vector.emplaceBack( 3 );
+        vector.emplace( 1_uz, 2 );
+        vector.insert( vector.begin(), Counted( 0 ) );
+        EXPECT_EQ( Counted::alive, 4 );
+        for( std::size_t k = 0; k < vector.length(); ++k ) {
+            EXPECT_EQ( vector[k].getValue(), static_cast<int>(k) );
+        }
+
+        vector.erase( vector.begin() + 1, vector.begin() + 3 );
+        EXPECT_EQ( Counted::alive, 2 );
+        EXPECT_EQ( vector.popBack().getValue(), 3 );
+        EXPECT_EQ( Counted::alive, 1 );
+
+        EDF::Vector<Counted, 64> copy( vector );
+        EXPECT_EQ( Counted::alive, 2 );
+        copy = vector;
+        EXPECT_EQ( Counted::alive, 2 );
+        EXPECT_EQ( copy.front().getValue(), 0 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(Vector, InsertPastEnd) {
+    Counted::alive = 0;
+    {
+        EDF::Vector<Counted, 8> vector;
+        vector.emplaceBack( 1 );
+        vector.emplaceBack( 2 );
+
+        // More new elements than elements after the position, some land in slots that were never constructed
+        vector.insert( vector.begin() + 1, 3, Counted( 9 ) );
+        EXPECT_EQ( Counted::alive, 5 );
+        const int expected[] = { 1, 9, 9, 9, 2 };
+        ASSERT_EQ( vector.length(), 5 );
+        for( std::size_t k = 0; k < vector.length(); ++k ) {
+            EXPECT_EQ( vector[k].getValue(), expected[k] );
+        }
+
+        vector.clear();
+        EXPECT_EQ( Counted::alive, 0 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
 TEST(Vector, PushBack) {
     EDF::Vector<int, 4> vector;
     EXPECT_EQ( vector.length(), 0 );
@@ -420,4 +562,88 @@ TEST(Vector, ReverseBeginEnd) {
     const auto& crend = array.crend();
     EXPECT_EQ( *crbegin, 4 );
     EXPECT_EQ( *(crend - 1), 1 );
-}
\ No newline at end of file
+}
+
+TEST(Vector, Assign) {
+    EDF::Vector<int, 8> vector = { 9, 9, 9, 9, 9 };
+    const int values[] = { 1, 2, 3 };
+
+    vector.assign( std::begin( values ), std::end( values ) );
+    ASSERT_EQ( vector.length(), 3 );
+    EXPECT_EQ( vector[0], 1 );
+    EXPECT_EQ( vector[1], 2 );
+    EXPECT_EQ( vector[2], 3 );
+}
+
+TEST(Vector, Append) {
+    EDF::Vector<int, 8> vector = { 1, 2 };
+    const int values[] = { 3, 4, 5 };
+
+    vector.append( std::begin( values ), std::end( values ) );
+    ASSERT_EQ( vector.length(), 5 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k], static_cast<int>(k + 1) );
+    }
+
+    // Single pass input range, the length isn't known before reading it
+    std::istringstream stream( "6 7 8" );
+    vector.append( std::istream_iterator<int>( stream ), std::istream_iterator<int>() );
+    ASSERT_EQ( vector.length(), 8 );
+    EXPECT_EQ( vector.back(), 8 );
+}
+
+TEST(Vector, AppendNotTriviallyCopyable) {
+    Counted::alive = 0;
+    {
+        EDF::Vector<Counted, 8> vector;
+        const Counted values[] = { Counted( 1 ), Counted( 2 ), Counted( 3 ) };
+        vector.append( std::begin( values ), std::end( values ) );
+        EXPECT_EQ( Counted::alive, 6 );
+        EXPECT_EQ( vector[2].getValue(), 3 );
+    }
+    EXPECT_EQ( Counted::alive, 0 );
+}
+
+TEST(Vector, Resize) {
+    EDF::Vector<int, 8> vector = { 1, 2, 3 };
+
+    vector.resize( 5 );
+    ASSERT_EQ( vector.length(), 5 );
+    EXPECT_EQ( vector[2], 3 );
+    EXPECT_EQ( vector[3], 0 );
+    EXPECT_EQ( vector[4], 0 );
+
+    vector.resize( 7, 9 );
+    ASSERT_EQ( vector.length(), 7 );
+    EXPECT_EQ( vector[5], 9 );
+    EXPECT_EQ( vector[6], 9 );
+
+    vector.resize( 2 );
+    ASSERT_EQ( vector.length(), 2 );
+    EXPECT_EQ( vector[1], 2 );
+
+    Counted::alive = 0;
+    EDF::Vector<Counted, 8> counted;
+    counted.resize( 4, Counted( 7 ) );
+    EXPECT_EQ( Counted::alive, 4 );
+    counted.resize( 1, Counted( 7 ) );
+    EXPECT_EQ( Counted::alive, 1 );
+}
+
+TEST(Vector, SpareCapacityCommit) {
+    EDF::Vector<std::uint16_t, 8> vector = { std::uint16_t( 1 ) };
+
+    auto spare = vector.spareCapacity();
+    ASSERT_EQ( spare.length(), 7 );
+    EXPECT_EQ( spare.data(), vector.data() + 1 );
+
+    // Stand in for a DMA transfer that filled part of the spare capacity
+    const std::uint16_t samples[] = { 2, 3, 4 };
+    std::memcpy( spare.data(), samples, sizeof(samples) );
+    vector.commit( 3 );
+    ASSERT_EQ( vector.length(), 4 );
+    for( std::size_t k = 0; k < vector.length(); ++k ) {
+        EXPECT_EQ( vector[k], k + 1 );
+    }
+    EXPECT_EQ( vector.spareCapacity().length(), 4 );
+}